@@ -0,0 +1,907 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace PCRE.Analyzers;
+
+/// <summary>
+/// A lightweight PCRE pattern scanner which looks for constructs that cause exponential backtracking.
+/// </summary>
+/// <remarks>
+/// This is a heuristic: the scanner only understands the common pattern syntax, and gives up on anything else.
+/// </remarks>
+internal static class BacktrackingPattern
+{
+    private const long _pcre2Caseless = 0x00000008;
+    private const long _pcre2DotAll = 0x00000020;
+    private const long _pcre2Extended = 0x00000080;
+    private const long _pcre2ExtendedMore = 0x01000000;
+    private const long _pcre2Literal = 0x02000000;
+
+    private const int _maxFragmentLength = 40;
+
+    public static BacktrackingIssue? Analyze(string pattern, long options)
+    {
+        if ((options & _pcre2Literal) != 0)
+            return null;
+
+        var root = new Parser(pattern, options).Parse();
+        return root is not null ? FindIssue(pattern, root, false) : null;
+    }
+
+    private static BacktrackingIssue? FindIssue(string pattern, Node node, bool isAtomicTail)
+    {
+        switch (node)
+        {
+            case QuantifierNode quantifier:
+                // A quantifier at the end of an atomic group or assertion is never backtracked into.
+                if (quantifier is { IsUnbounded: true, Mode: not QuantifierMode.Possessive } && !isAtomicTail)
+                {
+                    if (FindCoveringQuantifier(quantifier.Body) is { } inner)
+                    {
+                        return new BacktrackingIssue(
+                            BacktrackingIssueKind.NestedQuantifiers,
+                            [
+                                GetFragment(pattern, inner),
+                                GetFragment(pattern, quantifier),
+                                inner.Mode == QuantifierMode.Greedy
+                                    ? GetFragment(pattern, inner) + "+"
+                                    : $"(?>{GetFragment(pattern, inner)})"
+                            ]
+                        );
+                    }
+
+                    if (FindAmbiguousAlternatives(quantifier.Body) is var (first, second))
+                    {
+                        return new BacktrackingIssue(
+                            BacktrackingIssueKind.AmbiguousAlternation,
+                            [
+                                GetFragment(pattern, first),
+                                GetFragment(pattern, second),
+                                GetFragment(pattern, quantifier),
+                                quantifier.Mode == QuantifierMode.Greedy
+                                    ? GetFragment(pattern, quantifier) + "+"
+                                    : $"(?>{GetFragment(pattern, quantifier)})"
+                            ]
+                        );
+                    }
+                }
+
+                return FindIssue(pattern, quantifier.Body, false);
+
+            case GroupNode group:
+                return FindIssue(pattern, group.Content, isAtomicTail || group.Kind != GroupKind.Normal);
+
+            case SequenceNode sequence:
+                for (var i = 0; i < sequence.Items.Count; ++i)
+                {
+                    if (FindIssue(pattern, sequence.Items[i], isAtomicTail && i == sequence.Items.Count - 1) is { } issue)
+                        return issue;
+                }
+
+                return null;
+
+            case AlternationNode alternation:
+                foreach (var alternative in alternation.Alternatives)
+                {
+                    if (FindIssue(pattern, alternative, isAtomicTail) is { } issue)
+                        return issue;
+                }
+
+                return null;
+
+            default:
+                return null;
+        }
+    }
+
+    /// <summary>
+    /// Finds an unbounded quantifier which can match the whole repeated body on its own,
+    /// as in <c>(a+)+</c> or <c>(\w+\s?)*</c>: the input can then be split between iterations in many ways.
+    /// </summary>
+    private static QuantifierNode? FindCoveringQuantifier(Node node)
+    {
+        switch (node)
+        {
+            case QuantifierNode { IsUnbounded: true, Mode: not QuantifierMode.Possessive } quantifier:
+                return quantifier;
+
+            case GroupNode { Kind: GroupKind.Normal } group:
+                return FindCoveringQuantifier(group.Content);
+
+            case SequenceNode sequence:
+                var required = sequence.Items.Where(static i => !i.IsNullable).ToList();
+
+                return required.Count switch
+                {
+                    0 => sequence.Items.Select(FindCoveringQuantifier).FirstOrDefault(static i => i is not null),
+                    1 => FindCoveringQuantifier(required[0]),
+                    _ => null
+                };
+
+            case AlternationNode alternation:
+                return alternation.Alternatives.Select(FindCoveringQuantifier).FirstOrDefault(static i => i is not null);
+
+            default:
+                return null;
+        }
+    }
+
+    /// <summary>
+    /// Finds two alternatives which can match the same character, one of them being a single character item,
+    /// as in <c>(\w|\d)*</c>: each repeated character can then be matched by either alternative.
+    /// </summary>
+    private static (Node, Node)? FindAmbiguousAlternatives(Node node)
+    {
+        switch (node)
+        {
+            case GroupNode { Kind: GroupKind.Normal } group:
+                return FindAmbiguousAlternatives(group.Content);
+
+            case SequenceNode sequence:
+                var required = sequence.Items.Where(static i => !i.IsNullable).ToList();
+                return required.Count == 1 ? FindAmbiguousAlternatives(required[0]) : null;
+
+            case AlternationNode alternation:
+                var alternatives = alternation.Alternatives;
+
+                for (var i = 0; i < alternatives.Count; ++i)
+                {
+                    for (var j = i + 1; j < alternatives.Count; ++j)
+                    {
+                        if ((IsSingleCharacter(alternatives[i]) || IsSingleCharacter(alternatives[j]))
+                            && alternatives[i].First.Overlaps(alternatives[j].First))
+                        {
+                            return (alternatives[i], alternatives[j]);
+                        }
+                    }
+                }
+
+                return null;
+
+            default:
+                return null;
+        }
+    }
+
+    private static bool IsSingleCharacter(Node node)
+        => node switch
+        {
+            CharacterNode                              => true,
+            QuantifierNode quantifier                  => IsSingleCharacter(quantifier.Body),
+            GroupNode { Kind: GroupKind.Normal } group => IsSingleCharacter(group.Content),
+            SequenceNode { Items: [var item] }         => IsSingleCharacter(item),
+            _                                          => false
+        };
+
+    private static string GetFragment(string pattern, Node node)
+    {
+        var fragment = pattern.Substring(node.Offset, node.Length);
+
+        return fragment.Length > _maxFragmentLength
+            ? fragment.Substring(0, _maxFragmentLength) + "..."
+            : fragment;
+    }
+
+    private sealed class Parser(string pattern, long options)
+    {
+        private int _index;
+        private bool _caseless = (options & _pcre2Caseless) != 0;
+        private bool _dotAll = (options & _pcre2DotAll) != 0;
+        private bool _extended = (options & (_pcre2Extended | _pcre2ExtendedMore)) != 0;
+
+        public Node? Parse()
+        {
+            try
+            {
+                var node = ParseAlternation();
+                return _index == pattern.Length ? node : null;
+            }
+            catch (UnsupportedSyntaxException)
+            {
+                return null;
+            }
+        }
+
+        private bool Peek(string value)
+            => string.CompareOrdinal(pattern, _index, value, 0, value.Length) == 0;
+
+        private bool AtEnd => _index >= pattern.Length;
+
+        private char Current => _index < pattern.Length ? pattern[_index] : throw new UnsupportedSyntaxException();
+
+        private Node ParseAlternation()
+        {
+            var start = _index;
+            var alternatives = new List<Node> { ParseSequence() };
+
+            while (!AtEnd && pattern[_index] == '|')
+            {
+                ++_index;
+                alternatives.Add(ParseSequence());
+            }
+
+            return alternatives.Count == 1
+                ? alternatives[0]
+                : new AlternationNode(start, _index - start, alternatives);
+        }
+
+        private Node ParseSequence()
+        {
+            var start = _index;
+            var items = new List<Node>();
+
+            while (true)
+            {
+                SkipExtendedWhitespace();
+
+                if (AtEnd || pattern[_index] is '|' or ')')
+                    break;
+
+                var item = ParseAtom();
+                if (item is null)
+                    continue;
+
+                items.Add(ParseQuantifiers(item));
+            }
+
+            return new SequenceNode(start, _index - start, items);
+        }
+
+        private Node ParseQuantifiers(Node item)
+        {
+            while (true)
+            {
+                SkipExtendedWhitespace();
+
+                if (AtEnd)
+                    return item;
+
+                int min, max;
+
+                switch (pattern[_index])
+                {
+                    case '*':
+                        (min, max) = (0, -1);
+                        ++_index;
+                        break;
+
+                    case '+':
+                        (min, max) = (1, -1);
+                        ++_index;
+                        break;
+
+                    case '?':
+                        (min, max) = (0, 1);
+                        ++_index;
+                        break;
+
+                    case '{' when TryParseCountedQuantifier(out min, out max):
+                        break;
+
+                    default:
+                        return item;
+                }
+
+                var mode = QuantifierMode.Greedy;
+
+                if (!AtEnd && pattern[_index] == '+')
+                {
+                    mode = QuantifierMode.Possessive;
+                    ++_index;
+                }
+                else if (!AtEnd && pattern[_index] == '?')
+                {
+                    mode = QuantifierMode.Lazy;
+                    ++_index;
+                }
+
+                item = new QuantifierNode(item.Offset, _index - item.Offset, item, min, max, mode);
+            }
+        }
+
+        private bool TryParseCountedQuantifier(out int min, out int max)
+        {
+            // {n}, {n,}, {n,m} and {,m}, anything else is a literal
+            var index = _index + 1;
+            min = ReadNumber(ref index) ?? 0;
+            max = min;
+
+            if (index < pattern.Length && pattern[index] == ',')
+            {
+                ++index;
+                max = ReadNumber(ref index) ?? -1;
+
+                if (max < 0 && index == _index + 2)
+                    return false;
+            }
+            else if (index == _index + 1)
+            {
+                return false;
+            }
+
+            if (index >= pattern.Length || pattern[index] != '}')
+                return false;
+
+            _index = index + 1;
+            return true;
+        }
+
+        private int? ReadNumber(ref int index)
+        {
+            var start = index;
+            var value = 0;
+
+            while (index < pattern.Length && pattern[index] is >= '0' and <= '9')
+            {
+                value = value * 10 + (pattern[index] - '0');
+                ++index;
+
+                if (value > 65535)
+                    throw new UnsupportedSyntaxException();
+            }
+
+            return index > start ? value : null;
+        }
+
+        private Node? ParseAtom()
+        {
+            var start = _index;
+            var c = pattern[_index++];
+
+            switch (c)
+            {
+                case '(':
+                    return ParseGroup(start);
+
+                case '[':
+                    return new CharacterNode(start, _index - start, ParseClass());
+
+                case '\\':
+                    return ParseEscape(start);
+
+                case '.':
+                    return new CharacterNode(start, 1, _dotAll ? CharSet.Any : CharSet.AnyExceptNewLine);
+
+                case '^' or '$':
+                    return new ZeroWidthNode(start, 1);
+
+                default:
+                    return new CharacterNode(start, 1, CharSet.FromChar(c, _caseless));
+            }
+        }
+
+        private Node? ParseGroup(int start)
+        {
+            if (!AtEnd && pattern[_index] == '*')
+            {
+                // Alpha assertions such as (*pla:...) contain a pattern
+                if (_index + 1 < pattern.Length && pattern[_index + 1] is >= 'a' and <= 'z')
+                    throw new UnsupportedSyntaxException();
+
+                SkipPast(')');
+                return new ZeroWidthNode(start, _index - start);
+            }
+
+            var kind = GroupKind.Normal;
+            var savedOptions = (_caseless, _dotAll, _extended);
+
+            if (!AtEnd && pattern[_index] == '?')
+            {
+                ++_index;
+
+                switch (Current)
+                {
+                    case ':' or '|':
+                        ++_index;
+                        break;
+
+                    case '>':
+                        kind = GroupKind.Atomic;
+                        ++_index;
+                        break;
+
+                    case '=' or '!':
+                        kind = GroupKind.Lookaround;
+                        ++_index;
+                        break;
+
+                    case '<' when _index + 1 < pattern.Length && pattern[_index + 1] is '=' or '!':
+                        kind = GroupKind.Lookaround;
+                        _index += 2;
+                        break;
+
+                    case '<':
+                        SkipPast('>');
+                        break;
+
+                    case '\'':
+                        ++_index;
+                        SkipPast('\'');
+                        break;
+
+                    case 'P' when _index + 1 < pattern.Length && pattern[_index + 1] == '<':
+                        SkipPast('>');
+                        break;
+
+                    case 'R' or '&' or 'P' or (>= '0' and <= '9'):
+                    case '+' or '-' when _index + 1 < pattern.Length && pattern[_index + 1] is >= '0' and <= '9':
+                        // Recursion can match anything
+                        SkipPast(')');
+                        return new OpaqueNode(start, _index - start);
+
+                    case 'C' when _index + 1 < pattern.Length && pattern[_index + 1] is ')' or (>= '0' and <= '9'):
+                    case '#':
+                        SkipPast(')');
+                        return null;
+
+                    default:
+                        ParseInlineOptions();
+
+                        if (pattern[_index] == ')')
+                        {
+                            // (?i) applies to the rest of the enclosing group
+                            ++_index;
+                            return null;
+                        }
+
+                        ++_index;
+                        break;
+                }
+            }
+
+            var content = ParseAlternation();
+
+            if (Current != ')')
+                throw new UnsupportedSyntaxException();
+
+            ++_index;
+            (_caseless, _dotAll, _extended) = savedOptions;
+
+            return new GroupNode(start, _index - start, content, kind);
+        }
+
+        private void ParseInlineOptions()
+        {
+            var enable = true;
+
+            if (Current == '^')
+            {
+                (_caseless, _dotAll, _extended) = (false, false, false);
+                ++_index;
+            }
+
+            while (true)
+            {
+                switch (Current)
+                {
+                    case '-':
+                        enable = false;
+                        break;
+
+                    case 'i':
+                        _caseless = enable;
+                        break;
+
+                    case 's':
+                        _dotAll = enable;
+                        break;
+
+                    case 'x':
+                        _extended = enable;
+                        break;
+
+                    case 'm' or 'n' or 'U' or 'J':
+                        break;
+
+                    case ')' or ':':
+                        return;
+
+                    default:
+                        // Conditionals, callouts with strings etc.
+                        throw new UnsupportedSyntaxException();
+                }
+
+                ++_index;
+            }
+        }
+
+        private Node? ParseEscape(int start)
+        {
+            var c = Current;
+            ++_index;
+
+            switch (c)
+            {
+                case 'b' or 'B' or 'A' or 'z' or 'Z' or 'G' or 'K':
+                    return new ZeroWidthNode(start, 2);
+
+                case 'N':
+                    return new CharacterNode(start, 2, CharSet.AnyExceptNewLine);
+
+                case 'R':
+                    return new CharacterNode(start, 2, CharSet.VerticalSpace);
+
+                case 'X' or 'C':
+                    return new CharacterNode(start, 2, CharSet.Unknown);
+
+                case 'Q':
+                    var end = pattern.IndexOf("\\E", _index, StringComparison.Ordinal);
+                    var literal = end < 0 ? pattern.Substring(_index) : pattern.Substring(_index, end - _index);
+                    _index = end < 0 ? pattern.Length : end + 2;
+
+                    return literal.Length != 0
+                        ? new SequenceNode(start, _index - start, literal.Select(i => (Node)new CharacterNode(start, _index - start, CharSet.FromChar(i, _caseless))).ToList())
+                        : null;
+
+                case 'E':
+                    return null;
+
+                case >= '1' and <= '9':
+                    // Backreferences can match anything
+                    SkipWhile(static i => i is >= '0' and <= '9', int.MaxValue);
+                    return new OpaqueNode(start, _index - start);
+
+                case 'g' or 'k':
+                    if (Current is '{' or '<' or '\'')
+                        SkipPast(Current switch { '{' => '}', '<' => '>', _ => '\'' }, 1);
+                    else
+                        SkipWhile(static i => i is >= '0' and <= '9' or '+' or '-', int.MaxValue);
+
+                    return new OpaqueNode(start, _index - start);
+
+                default:
+                    return new CharacterNode(start, _index - start, ParseEscapedChar(c, out _));
+            }
+        }
+
+        /// <summary>
+        /// Parses an escape which is valid both inside and outside of a character class.
+        /// </summary>
+        private CharSet ParseEscapedChar(char c, out char? value)
+        {
+            value = c switch
+            {
+                'n' => '\n',
+                'r' => '\r',
+                't' => '\t',
+                'f' => '\f',
+                'e' => '\x1B',
+                'a' => '\a',
+                _   => c is >= 'a' and <= 'z' or >= 'A' and <= 'Z' or >= '0' and <= '9' ? null : c
+            };
+
+            if (value is { } literal)
+                return CharSet.FromChar(literal, _caseless);
+
+            switch (c)
+            {
+                case 'd': return CharSet.Digit;
+                case 'D': return CharSet.Digit.Negate();
+                case 'w': return CharSet.Word;
+                case 'W': return CharSet.Word.Negate();
+                case 's': return CharSet.Space;
+                case 'S': return CharSet.Space.Negate();
+                case 'h': return CharSet.HorizontalSpace;
+                case 'H': return CharSet.HorizontalSpace.Negate();
+                case 'v': return CharSet.VerticalSpace;
+                case 'V': return CharSet.VerticalSpace.Negate();
+
+                case 'p' or 'P':
+                    if (Current == '{')
+                        SkipPast('}');
+                    else
+                        ++_index;
+
+                    return CharSet.Unknown;
+
+                case 'x':
+                    if (!AtEnd && pattern[_index] == '{')
+                        SkipPast('}');
+                    else
+                        SkipWhile(static i => i is >= '0' and <= '9' or >= 'a' and <= 'f' or >= 'A' and <= 'F', 2);
+
+                    return CharSet.Unknown;
+
+                case 'o':
+                    SkipPast('}');
+                    return CharSet.Unknown;
+
+                case '0':
+                    SkipWhile(static i => i is >= '0' and <= '7', 2);
+                    return CharSet.Unknown;
+
+                case 'c':
+                    ++_index;
+                    return CharSet.Unknown;
+
+                default:
+                    throw new UnsupportedSyntaxException();
+            }
+        }
+
+        private void SkipPast(char terminator, int offset = 0)
+        {
+            var end = pattern.IndexOf(terminator, _index + offset);
+            if (end < 0)
+                throw new UnsupportedSyntaxException();
+
+            _index = end + 1;
+        }
+
+        private void SkipWhile(Func<char, bool> predicate, int maxLength)
+        {
+            for (var i = 0; i < maxLength && !AtEnd && predicate(pattern[_index]); ++i)
+                ++_index;
+        }
+
+        private CharSet ParseClass()
+        {
+            var set = CharSet.Empty;
+            var negated = false;
+
+            if (!AtEnd && pattern[_index] == '^')
+            {
+                negated = true;
+                ++_index;
+            }
+
+            var first = true;
+
+            while (true)
+            {
+                var c = Current;
+
+                if (c == ']' && !first)
+                {
+                    ++_index;
+                    break;
+                }
+
+                first = false;
+
+                if (c == '[' && _index + 1 < pattern.Length && pattern[_index + 1] == ':')
+                {
+                    // POSIX classes
+                    SkipPast(']', 1);
+                    set = set.Union(CharSet.Unknown);
+                    continue;
+                }
+
+                var item = ParseClassItem(out var single);
+
+                if (single is { } rangeStart
+                    && _index + 1 < pattern.Length
+                    && pattern[_index] == '-'
+                    && pattern[_index + 1] != ']')
+                {
+                    ++_index;
+                    ParseClassItem(out var rangeEnd);
+
+                    if (rangeEnd is null || rangeEnd < rangeStart)
+                        throw new UnsupportedSyntaxException();
+
+                    item = CharSet.FromRange(rangeStart, rangeEnd.Value, _caseless);
+                }
+
+                set = set.Union(item);
+            }
+
+            return negated ? set.Negate() : set;
+        }
+
+        private CharSet ParseClassItem(out char? single)
+        {
+            single = null;
+            var c = Current;
+            ++_index;
+
+            if (c != '\\')
+            {
+                single = c;
+                return CharSet.FromChar(c, _caseless);
+            }
+
+            c = Current;
+            ++_index;
+
+            if (c == 'b')
+            {
+                single = '\b';
+                return CharSet.FromChar('\b', false);
+            }
+
+            return ParseEscapedChar(c, out single);
+        }
+
+        private void SkipExtendedWhitespace()
+        {
+            if (!_extended)
+                return;
+
+            while (!AtEnd)
+            {
+                var c = pattern[_index];
+
+                if (c == '#')
+                {
+                    while (!AtEnd && pattern[_index] != '\n')
+                        ++_index;
+                }
+                else if (char.IsWhiteSpace(c))
+                {
+                    ++_index;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    private sealed class UnsupportedSyntaxException : Exception;
+
+    private enum GroupKind
+    {
+        Normal,
+        Atomic,
+        Lookaround
+    }
+
+    private enum QuantifierMode
+    {
+        Greedy,
+        Lazy,
+        Possessive
+    }
+
+    private abstract class Node(int offset, int length)
+    {
+        public int Offset { get; } = offset;
+        public int Length { get; } = length;
+
+        public abstract bool IsNullable { get; }
+        public abstract CharSet First { get; }
+    }
+
+    private sealed class CharacterNode(int offset, int length, CharSet set) : Node(offset, length)
+    {
+        public override bool IsNullable => false;
+        public override CharSet First => set;
+    }
+
+    private sealed class ZeroWidthNode(int offset, int length) : Node(offset, length)
+    {
+        public override bool IsNullable => true;
+        public override CharSet First => CharSet.Empty;
+    }
+
+    private sealed class OpaqueNode(int offset, int length) : Node(offset, length)
+    {
+        public override bool IsNullable => false;
+        public override CharSet First => CharSet.Unknown;
+    }
+
+    private sealed class GroupNode(int offset, int length, Node content, GroupKind kind) : Node(offset, length)
+    {
+        public Node Content { get; } = content;
+        public GroupKind Kind { get; } = kind;
+
+        public override bool IsNullable => Kind == GroupKind.Lookaround || Content.IsNullable;
+        public override CharSet First => Kind == GroupKind.Lookaround ? CharSet.Empty : Content.First;
+    }
+
+    private sealed class QuantifierNode(int offset, int length, Node body, int min, int max, QuantifierMode mode) : Node(offset, length)
+    {
+        public Node Body { get; } = body;
+        public QuantifierMode Mode { get; } = mode;
+        public bool IsUnbounded => max < 0;
+
+        public override bool IsNullable => min == 0 || Body.IsNullable;
+        public override CharSet First => max == 0 ? CharSet.Empty : Body.First;
+    }
+
+    private sealed class SequenceNode(int offset, int length, List<Node> items) : Node(offset, length)
+    {
+        public List<Node> Items { get; } = items;
+
+        public override bool IsNullable => Items.TrueForAll(static i => i.IsNullable);
+
+        public override CharSet First
+        {
+            get
+            {
+                var first = CharSet.Empty;
+
+                foreach (var item in Items)
+                {
+                    first = first.Union(item.First);
+
+                    if (!item.IsNullable)
+                        break;
+                }
+
+                return first;
+            }
+        }
+    }
+
+    private sealed class AlternationNode(int offset, int length, List<Node> alternatives) : Node(offset, length)
+    {
+        public List<Node> Alternatives { get; } = alternatives;
+
+        public override bool IsNullable => Alternatives.Exists(static i => i.IsNullable);
+        public override CharSet First => Alternatives.Aggregate(CharSet.Empty, static (set, i) => set.Union(i.First));
+    }
+
+    /// <summary>
+    /// An approximate character set: ASCII characters are tracked exactly, other characters are tracked as a whole.
+    /// Sets which can't be represented (such as Unicode properties) are unknown and never overlap anything.
+    /// </summary>
+    private readonly record struct CharSet(ulong Low, ulong High, bool NonAscii, bool IsUnknown)
+    {
+        public static CharSet Empty => default;
+        public static CharSet Unknown => new(0, 0, false, true);
+        public static CharSet Any => new(ulong.MaxValue, ulong.MaxValue, true, false);
+        public static CharSet AnyExceptNewLine => Any.Except(FromChar('\n', false));
+
+        public static CharSet Digit => FromRange('0', '9', false);
+        public static CharSet Word => FromRange('a', 'z', true).Union(Digit).Union(FromChar('_', false));
+        public static CharSet Space => FromRange('\t', '\r', false).Union(FromChar(' ', false));
+        public static CharSet HorizontalSpace => FromChar('\t', false).Union(FromChar(' ', false)).Union(new CharSet(0, 0, true, false));
+        public static CharSet VerticalSpace => FromRange('\n', '\r', false).Union(new CharSet(0, 0, true, false));
+
+        public static CharSet FromChar(char c, bool caseless)
+            => FromRange(c, c, caseless);
+
+        public static CharSet FromRange(char start, char end, bool caseless)
+        {
+            var set = Empty;
+
+            if (end > 127)
+                set = set with { NonAscii = true };
+
+            for (var c = start; c <= end && c <= 127; ++c)
+            {
+                set = set.With(c);
+
+                if (caseless && char.IsLetter(c))
+                    set = set.With(char.ToLowerInvariant(c)).With(char.ToUpperInvariant(c));
+            }
+
+            return set;
+        }
+
+        private CharSet With(char c)
+            => c < 64
+                ? this with { Low = Low | (1UL << c) }
+                : this with { High = High | (1UL << (c - 64)) };
+
+        public CharSet Union(CharSet other)
+            => new(Low | other.Low, High | other.High, NonAscii || other.NonAscii, IsUnknown || other.IsUnknown);
+
+        public CharSet Except(CharSet other)
+            => new(Low & ~other.Low, High & ~other.High, NonAscii && !other.NonAscii, IsUnknown);
+
+        public CharSet Negate()
+            => IsUnknown ? this : Any.Except(this);
+
+        public bool Overlaps(CharSet other)
+            => !IsUnknown
+               && !other.IsUnknown
+               && ((Low & other.Low) != 0 || (High & other.High) != 0 || (NonAscii && other.NonAscii));
+    }
+}
+
+internal enum BacktrackingIssueKind
+{
+    NestedQuantifiers,
+    AmbiguousAlternation
+}
+
+internal sealed class BacktrackingIssue(BacktrackingIssueKind kind, string[] messageArgs)
+{
+    public BacktrackingIssueKind Kind { get; } = kind;
+    public string[] MessageArgs { get; } = messageArgs;
+}
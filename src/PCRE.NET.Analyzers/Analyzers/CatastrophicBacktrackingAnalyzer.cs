@@ -0,0 +1,96 @@
+using System.Collections.Immutable;
+using Microsoft.CodeAnalysis;
+using Microsoft.CodeAnalysis.Diagnostics;
+using Microsoft.CodeAnalysis.Operations;
+
+namespace PCRE.Analyzers;
+
+[DiagnosticAnalyzer(LanguageNames.CSharp)]
+public sealed class CatastrophicBacktrackingAnalyzer : DiagnosticAnalyzer
+{
+    private const string _category = "Performance";
+
+    private const string _description = "Patterns which can match the same input in many different ways can take an exponential time to fail. "
+                                        + "Make the quantifiers possessive or use atomic groups, or compile the pattern with PcreOptions.Compiled "
+                                        + "and bound the matching with PcreMatchSettings.MatchLimit or PcreMatchSettings.Timeout.";
+
+    public static readonly DiagnosticDescriptor NestedQuantifiersRule = new(
+        "PCRE0001",
+        "Nested unbounded quantifiers may cause catastrophic backtracking",
+        "The quantifier '{0}' is repeated by '{1}', which may cause catastrophic backtracking. Consider using '{2}' instead.",
+        _category,
+        DiagnosticSeverity.Warning,
+        isEnabledByDefault: true,
+        description: _description
+    );
+
+    public static readonly DiagnosticDescriptor AmbiguousAlternationRule = new(
+        "PCRE0002",
+        "Ambiguous alternation under repetition may cause catastrophic backtracking",
+        "The alternatives '{0}' and '{1}' can match the same input and are repeated by '{2}', which may cause catastrophic backtracking. Consider using '{3}' instead.",
+        _category,
+        DiagnosticSeverity.Warning,
+        isEnabledByDefault: true,
+        description: _description
+    );
+
+    public override ImmutableArray<DiagnosticDescriptor> SupportedDiagnostics { get; } = ImmutableArray.Create(NestedQuantifiersRule, AmbiguousAlternationRule);
+
+    public override void Initialize(AnalysisContext context)
+    {
+        context.ConfigureGeneratedCodeAnalysis(GeneratedCodeAnalysisFlags.None);
+        context.EnableConcurrentExecution();
+
+        context.RegisterOperationAction(
+            static context => Analyze(context, ((IInvocationOperation)context.Operation).TargetMethod, ((IInvocationOperation)context.Operation).Arguments),
+            OperationKind.Invocation
+        );
+
+        context.RegisterOperationAction(
+            static context => Analyze(context, ((IObjectCreationOperation)context.Operation).Constructor, ((IObjectCreationOperation)context.Operation).Arguments),
+            OperationKind.ObjectCreation
+        );
+    }
+
+    private static void Analyze(OperationAnalysisContext context, IMethodSymbol? method, ImmutableArray<IArgumentOperation> arguments)
+    {
+        if (method?.ContainingType is not { Name: "PcreRegex" or "PcreRegexUtf8", ContainingNamespace: { Name: "PCRE", ContainingNamespace.IsGlobalNamespace: true } })
+            return;
+
+        IArgumentOperation? patternArg = null;
+        long options = 0;
+
+        foreach (var argument in arguments)
+        {
+            switch (argument.Parameter?.Name)
+            {
+                case "pattern":
+                    patternArg = argument;
+                    break;
+
+                case "options":
+                    if (argument.Value.ConstantValue is not { HasValue: true, Value: long value })
+                        return; // The options may change the pattern syntax
+
+                    options = value;
+                    break;
+
+                case "settings":
+                    return;
+            }
+        }
+
+        if (patternArg?.Value.ConstantValue is not { HasValue: true, Value: string pattern })
+            return;
+
+        if (BacktrackingPattern.Analyze(pattern, options) is not { } issue)
+            return;
+
+        var rule = issue.Kind == BacktrackingIssueKind.NestedQuantifiers
+            ? NestedQuantifiersRule
+            : AmbiguousAlternationRule;
+
+        // ReSharper disable once CoVariantArrayConversion
+        context.ReportDiagnostic(Diagnostic.Create(rule, patternArg.Value.Syntax.GetLocation(), issue.MessageArgs));
+    }
+}
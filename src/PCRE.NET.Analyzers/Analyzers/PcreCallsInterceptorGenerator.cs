@@ -6,6 +6,7 @@ using System.Threading;
 using Microsoft.CodeAnalysis;
 using Microsoft.CodeAnalysis.CSharp;
 using Microsoft.CodeAnalysis.CSharp.Syntax;
+using Microsoft.CodeAnalysis.Diagnostics;
 using Microsoft.CodeAnalysis.Operations;
 
 namespace PCRE.Analyzers;
@@ -24,6 +25,9 @@ public sealed class PcreCallsInterceptorGenerator : IIncrementalGenerator
         var isEnabled = context.ParseOptionsProvider
                                .Select(static (parseOptions, _) => IsEnabled(parseOptions));
 
+        var hasPrecompiledPatterns = context.AnalyzerConfigOptionsProvider
+                                            .Select(static (options, _) => HasPrecompiledPatterns(options));
+
         var pipeline = invocations.Combine(isEnabled)
                                   .SelectMany(static (pair, _) =>
                                   {
@@ -32,18 +36,21 @@ public sealed class PcreCallsInterceptorGenerator : IIncrementalGenerator
                                           ? ImmutableArray.Create(invocation)
                                           : ImmutableArray<InvocationModel>.Empty;
                                   })
-                                  .Collect();
+                                  .Collect()
+                                  .Combine(hasPrecompiledPatterns);
 
         context.RegisterImplementationSourceOutput(
             pipeline,
-            static (context, invocations) =>
+            static (context, pair) =>
             {
+                var (invocations, hasPrecompiledPatterns) = pair;
+
                 if (invocations.Length == 0)
                     return;
 
                 context.AddSource(
                     "PcreCallsInterceptor.g.cs",
-                    new Generator().Generate(invocations)
+                    new Generator(hasPrecompiledPatterns).Generate(invocations)
                 );
             }
         );
@@ -63,6 +70,13 @@ public sealed class PcreCallsInterceptorGenerator : IIncrementalGenerator
                          .Contains(_generatedNamespace);
     }
 
+    private static bool HasPrecompiledPatterns(AnalyzerConfigOptionsProvider options)
+    {
+        // Set by the PcreNetPrecompiledPatterns MSBuild property, which embeds persistent cache entries as resources.
+        return options.GlobalOptions.TryGetValue("build_property.PcreNetPrecompiledPatterns", out var value)
+               && !string.IsNullOrWhiteSpace(value);
+    }
+
     private static bool SyntaxPredicate(SyntaxNode node, CancellationToken cancellationToken)
     {
         if (!node.IsKind(SyntaxKind.InvocationExpression))
@@ -125,7 +139,7 @@ public sealed class PcreCallsInterceptorGenerator : IIncrementalGenerator
         return null;
     }
 
-    private class Generator
+    private class Generator(bool hasPrecompiledPatterns)
     {
         private readonly CodeWriter _writer = new();
 
@@ -137,6 +151,9 @@ public sealed class PcreCallsInterceptorGenerator : IIncrementalGenerator
             using (_writer.WriteBlock($"namespace {_generatedNamespace}"))
             using (_writer.WriteBlock("file static class PcreCallsInterceptor"))
             {
+                if (hasPrecompiledPatterns)
+                    AppendPrecompiledPatternsRegistration();
+
                 GenerateInterceptors(invocations);
             }
 
@@ -171,6 +188,18 @@ public sealed class PcreCallsInterceptorGenerator : IIncrementalGenerator
             );
         }
 
+        private void AppendPrecompiledPatternsRegistration()
+        {
+            // Runs before the first pattern is created by an interceptor
+            _writer.AppendLine(
+                """
+                static PcreCallsInterceptor()
+                    => global::PCRE.PcrePersistentCache.AddPrecompiledPatterns(typeof(PcreCallsInterceptor).Assembly);
+
+                """
+            );
+        }
+
         private void AppendInterceptsLocationAttributeLine(InterceptableLocation location)
         {
             _writer.Append(location.GetInterceptsLocationAttributeSyntax())
@@ -217,6 +246,19 @@ public sealed class PcreCallsInterceptorGenerator : IIncrementalGenerator
                     """
                 );
 
+                // IsMatch calls don't expose the match data, so they can reuse a buffer per thread
+                if (regexGroup.Any(i => i.Method.Name is "IsMatch"))
+                {
+                    _writer.AppendLine(
+                        $"""
+                        [global::System.ThreadStatic]
+                        private static global::PCRE.PcreMatchBuffer? _regex{regexCounter}Buffer;
+                        private static global::PCRE.PcreMatchBuffer Regex{regexCounter}Buffer => _regex{regexCounter}Buffer ??= Regex{regexCounter}.CreateMatchBuffer();
+
+                        """
+                    );
+                }
+
                 var callCounter = 0;
 
                 foreach (var methodGroup in regexGroup.GroupBy(i => i.Method))
@@ -233,7 +275,7 @@ public sealed class PcreCallsInterceptorGenerator : IIncrementalGenerator
                         _writer.Append(
                             $"""
                             public static {method.ReturnType} Regex{regexCounter}_Call{callCounter}_{method.ParametersSignature}
-                                => Regex{regexCounter}.{method.Name}(
+                                => Regex{regexCounter}{(method.Name is "IsMatch" ? "Buffer" : "")}.{method.Name}(
                             """
                         );
 
@@ -1,59 +1,80 @@
 ﻿using System;
+using System.Collections.Generic;
 using System.Diagnostics.CodeAnalysis;
 using System.Text;
 using PCRE.Internal;
 
 namespace PCRE.Benchmarks;
 
+/// <summary>
+/// Checks that the zero-allocation code paths don't allocate, and that the others stay within their allocation budget.
+/// </summary>
+/// <remarks>
+/// Allocated bytes are only measured on .NET, the .NET Framework run only checks that no garbage collection occurs on the zero-allocation paths.
+/// </remarks>
 internal static class AllocationTest
 {
-    [SuppressMessage("ReSharper", "UseIndexFromEndExpression")]
+    private const int _warmupIterations = 10;
+    private const int _iterations = 25000;
+
     public static bool TestAllocations()
     {
-        var regexBuilder = new StringBuilder();
-        var subjectBuilder = new StringBuilder();
+        var success = true;
 
-        regexBuilder.Append("(?<char>.)");
-
-        for (var i = 0; i < 2 * InternalRegex.MaxStackAllocCaptureCount; ++i)
-        {
-            regexBuilder.Append("(?C{before})(.)(?C{after})");
-            subjectBuilder.Append("foobar");
-        }
+        foreach (var scenario in GetScenarios())
+            success &= Run(scenario);
 
-        var re = new PcreRegex(regexBuilder.ToString(), PcreOptions.Compiled);
-        var buffer = re.CreateMatchBuffer();
-        var subject = subjectBuilder.ToString();
-        var matchCount = 0;
+        Console.WriteLine(success ? "All scenarios passed" : "Some scenarios failed");
+        return success;
+    }
 
-        for (var i = 0; i < 10; ++i)
-            Iteration();
+    private static bool Run(Scenario scenario)
+    {
+        for (var i = 0; i < _warmupIterations; ++i)
+            scenario.Iteration();
 
         GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced, true);
         var gcCountBefore = GC.CollectionCount(0);
         var bytesBefore = GetAllocatedBytes();
 
-        for (var i = 0; i < 25000; ++i)
-            Iteration();
+        for (var i = 0; i < _iterations; ++i)
+            scenario.Iteration();
 
         var bytesAfter = GetAllocatedBytes();
         var gcCountAfter = GC.CollectionCount(0);
 
-        var allocatedBytes = bytesAfter - bytesBefore;
+        var bytesPerIteration = (double)(bytesAfter - bytesBefore) / _iterations;
         var gcCount = gcCountAfter - gcCountBefore;
 
-#if NET
-        Console.WriteLine($"Allocated bytes: {allocatedBytes}");
-#endif
+        var success = scenario.MaxBytesPerIteration == 0
+            ? bytesAfter == bytesBefore && gcCount == 0
+            : bytesPerIteration <= scenario.MaxBytesPerIteration;
 
-        Console.WriteLine($"GC count: {gcCount}");
-        Console.WriteLine($"Match count: {matchCount}");
+        Console.WriteLine($"{(success ? "OK  " : "FAIL")} {scenario.Name,-45} {bytesPerIteration,10:N1} B/op (max {scenario.MaxBytesPerIteration}), GC count: {gcCount}");
+        return success;
+    }
 
-        return allocatedBytes == 0 && gcCount == 0;
+    [SuppressMessage("ReSharper", "UseIndexFromEndExpression")]
+    private static IEnumerable<Scenario> GetScenarios()
+    {
+        var calloutRegexBuilder = new StringBuilder();
+        var calloutSubjectBuilder = new StringBuilder();
+
+        calloutRegexBuilder.Append("(?<char>.)");
 
-        void Iteration()
+        for (var i = 0; i < 2 * InternalRegex.MaxStackAllocCaptureCount; ++i)
         {
-            var matches = buffer.Matches(subject.AsSpan(), 0, PcreMatchOptions.None, static data =>
+            calloutRegexBuilder.Append("(?C{before})(.)(?C{after})");
+            calloutSubjectBuilder.Append("foobar");
+        }
+
+        var calloutRegex = new PcreRegex(calloutRegexBuilder.ToString(), PcreOptions.Compiled);
+        var calloutBuffer = calloutRegex.CreateMatchBuffer();
+        var calloutSubject = calloutSubjectBuilder.ToString();
+
+        yield return new Scenario("Buffer Matches with callouts", () =>
+        {
+            var matches = calloutBuffer.Matches(calloutSubject.AsSpan(), 0, PcreMatchOptions.None, static data =>
             {
                 _ = data.Match.Groups["char"].Value;
                 _ = data.Match.Groups[data.Match.Groups.Count - 1].Value;
@@ -67,9 +88,98 @@ internal static class AllocationTest
                 _ = match.Value;
                 _ = match.Groups["char"].Value;
                 _ = match.Groups[match.Groups.Count - 1].Value;
-                ++matchCount;
             }
-        }
+        });
+
+        const string pattern = @"(?<word>\w+)@(?<domain>\w+)\.(?<tld>com|org)";
+        const string subject = "foo@example.com, bar@example.org, baz@example.net, qux@example.com";
+
+        var regex = new PcreRegex(pattern, PcreOptions.Compiled);
+        var interpretedRegex = new PcreRegex(pattern);
+        var buffer = regex.CreateMatchBuffer();
+
+        yield return new Scenario("Span IsMatch", () => _ = regex.IsMatch(subject.AsSpan()));
+
+        yield return new Scenario("Span EnumerateMatchRanges", () =>
+        {
+            foreach (var range in regex.EnumerateMatchRanges(subject.AsSpan()))
+                _ = range.Length;
+        });
+
+        yield return new Scenario("PcreRefMatch group access", () =>
+        {
+            var match = buffer.Match(subject.AsSpan());
+
+            _ = match[1].Value;
+            _ = match["domain"].Value;
+            _ = match.Groups["tld"].Index;
+            _ = match.TryGetGroup("word", out var group) && group.Success;
+
+            foreach (var item in match.Groups)
+                _ = item.Length;
+
+            foreach (var item in match.GetDuplicateNamedGroups("word"))
+                _ = item.Value;
+        });
+
+        yield return new Scenario("Buffer Matches", () =>
+        {
+            foreach (var match in buffer.Matches(subject.AsSpan()))
+                _ = match.Value;
+        });
+
+        yield return new Scenario("Rented buffer Matches", () =>
+        {
+            var rentedBuffer = regex.RentMatchBuffer();
+
+            foreach (var match in rentedBuffer.Matches(subject.AsSpan()))
+                _ = match.Value;
+
+            regex.ReturnMatchBuffer(rentedBuffer);
+        });
+
+        var subjectUtf8 = Encoding.UTF8.GetBytes(subject);
+        var bufferUtf8 = new PcreRegexUtf8(pattern, PcreOptions.Compiled).CreateMatchBuffer();
+
+        yield return new Scenario("UTF-8 buffer Matches", () =>
+        {
+            foreach (var match in bufferUtf8.Matches(subjectUtf8))
+                _ = match["domain"].Value;
+        });
+
+        var latin1 = Encoding.GetEncoding("ISO-8859-1");
+        var buffer8Bit = new PcreRegex8Bit(latin1.GetBytes(pattern), latin1, PcreOptions.Compiled).CreateMatchBuffer();
+        var subject8Bit = latin1.GetBytes(subject);
+
+        yield return new Scenario("8-bit buffer Matches", () =>
+        {
+            foreach (var match in buffer8Bit.Matches(subject8Bit))
+                _ = match["domain"].Value;
+        });
+
+        yield return new Scenario("Static IsValidUtf", () =>
+        {
+            _ = PcreRegex.IsValidUtf(subject.AsSpan());
+            _ = PcreRegexUtf8.IsValidUtf(subjectUtf8);
+        });
+
+        // The following paths allocate, so they are checked against a budget instead.
+        // The span API of PcreRegex allocates an output vector for each match, which is owned by the returned PcreRefMatch.
+
+        yield return new Scenario("Span Match", () => _ = interpretedRegex.Match(subject.AsSpan()).Value, 96);
+
+        yield return new Scenario("Span Matches", () =>
+        {
+            foreach (var match in regex.Matches(subject.AsSpan()))
+                _ = match.Value;
+        }, 288);
+
+        yield return new Scenario("DFA Match", () => _ = interpretedRegex.Dfa.Match(subject).LongestMatch.Index, 2304);
+
+        yield return new Scenario("Span Substitute", () => _ = regex.Substitute(subject.AsSpan(), "$1".AsSpan(), PcreSubstituteOptions.SubstituteGlobal), 4 * subject.Length);
+
+        // The static helpers create a PcreRegex instance around the cached pattern.
+        yield return new Scenario("Static IsMatch", () => _ = PcreRegex.IsMatch(subject, pattern), 48);
     }
 
     private static long GetAllocatedBytes()
@@ -78,4 +188,11 @@ internal static class AllocationTest
 #else
         => 0;
 #endif
+
+    private sealed class Scenario(string name, Action iteration, long maxBytesPerIteration = 0)
+    {
+        public string Name { get; } = name;
+        public Action Iteration { get; } = iteration;
+        public long MaxBytesPerIteration { get; } = maxBytesPerIteration;
+    }
 }
@@ -11,6 +11,8 @@ public class AutoCalloutBenchmark
     private readonly PcreRegex _regexInterpretedAutoCallout;
     private readonly PcreRegex _regexCompiledNoCallout;
     private readonly PcreRegex _regexCompiledAutoCallout;
+    private readonly PcreMatchBuffer _bufferInterpretedProfile;
+    private readonly PcreMatchBuffer _bufferCompiledProfile;
 
     public AutoCalloutBenchmark()
     {
@@ -21,6 +23,9 @@ public class AutoCalloutBenchmark
 
         _regexCompiledNoCallout = new PcreRegex(regex, PcreOptions.Compiled);
         _regexCompiledAutoCallout = new PcreRegex(regex, PcreOptions.Compiled | PcreOptions.AutoCallout);
+
+        _bufferInterpretedProfile = _regexInterpretedNoCallout.CreateMatchBuffer(new PcreMatchSettings { CollectProfile = true });
+        _bufferCompiledProfile = _regexCompiledNoCallout.CreateMatchBuffer(new PcreMatchSettings { CollectProfile = true });
     }
 
     [Benchmark(Baseline = true)]
@@ -38,4 +43,12 @@ public class AutoCalloutBenchmark
     [Benchmark]
     public PcreMatch CompiledAutoCallout()
         => _regexCompiledAutoCallout.Match(_subjectString, _ => PcreCalloutResult.Pass);
+
+    [Benchmark]
+    public bool InterpretedProfile()
+        => _bufferInterpretedProfile.Match(_subjectString).Success;
+
+    [Benchmark]
+    public bool CompiledProfile()
+        => _bufferCompiledProfile.Match(_subjectString).Success;
 }
@@ -0,0 +1,54 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+
+namespace PCRE.Benchmarks;
+
+[Config(typeof(NetCoreStandardConfig))]
+public class ClassIteratorBenchmark
+{
+    private readonly PcreRegex _email = new(@"[a-z0-9._-]+@", PcreOptions.Compiled);
+    private readonly PcreRegex _digits = new(@"\d+;", PcreOptions.Compiled);
+    private readonly PcreRegex _notChar = new(@"[^;]+;", PcreOptions.Compiled);
+
+    private PcreMatchBuffer _emailBuffer = null!;
+    private PcreMatchBuffer _digitsBuffer = null!;
+    private PcreMatchBuffer _notCharBuffer = null!;
+
+    private string _letters = null!;
+    private string _digitRun = null!;
+
+    [Params(64, 4096)]
+    public int RunLength { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // Each subject is a single long run of the iterated class, followed by the terminator.
+        _letters = new string('a', RunLength) + "@";
+        _digitRun = new string('7', RunLength) + ";";
+
+        _emailBuffer = _email.CreateMatchBuffer();
+        _digitsBuffer = _digits.CreateMatchBuffer();
+        _notCharBuffer = _notChar.CreateMatchBuffer();
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _emailBuffer.Dispose();
+        _digitsBuffer.Dispose();
+        _notCharBuffer.Dispose();
+    }
+
+    [Benchmark(Baseline = true)]
+    public bool Class()
+        => _emailBuffer.Match(_letters.AsSpan()).Success;
+
+    [Benchmark]
+    public bool Digits()
+        => _digitsBuffer.Match(_digitRun.AsSpan()).Success;
+
+    [Benchmark]
+    public bool NegatedChar()
+        => _notCharBuffer.Match(_digitRun.AsSpan()).Success;
+}
@@ -26,3 +26,11 @@ internal class NetCoreStandardFrameworkConfig : ManualConfig
         );
     }
 }
+
+internal class CorpusConfig : ManualConfig
+{
+    public CorpusConfig()
+    {
+        AddColumn(new ThroughputColumn());
+    }
+}
@@ -0,0 +1,160 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Text.RegularExpressions;
+using BenchmarkDotNet.Attributes;
+using PCRE.Dfa;
+
+namespace PCRE.Benchmarks;
+
+/// <summary>
+/// Counts the matches of each pattern of the catalogue in its corpus, with each engine.
+/// </summary>
+/// <remarks>
+/// The throughput is reported in MB/s of UTF-8 input. All the engines should report the same match count, which is checked by the validator.
+/// </remarks>
+[Config(typeof(CorpusConfig))]
+[MemoryDiagnoser]
+[ReturnValueValidator]
+public class CorpusBenchmark
+{
+    private readonly PcreDfaMatchSettings _dfaSettings = new() { MaxResults = 1, AdditionalOptions = PcreDfaMatchOptions.NoUtfCheck };
+
+    private string _subject = null!;
+    private byte[] _subjectBytes = null!;
+
+    private PcreRegex _interpretedRegex = null!;
+    private PcreRegex _compiledRegex = null!;
+    private PcreMatchBuffer _interpretedBuffer = null!;
+    private PcreMatchBuffer _compiledBuffer = null!;
+    private PcreMatchBuffer8Bit _compiledBuffer8Bit = null!;
+
+    private Regex _regex = null!;
+    private Regex _compiledRegexNet = null!;
+#if NET
+    private Regex _nonBacktrackingRegex = null!;
+#endif
+
+    [ParamsSource(nameof(Cases))]
+    public CorpusBenchmarkCase Case { get; set; } = null!;
+
+    public static IEnumerable<CorpusBenchmarkCase> Cases => CorpusBenchmarkData.Cases;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _subject = CorpusBenchmarkData.GetCorpus(Case.Corpus);
+        _subjectBytes = CorpusBenchmarkData.GetCorpusBytes(Case.Corpus);
+
+        _interpretedRegex = new PcreRegex(Case.Pattern, Case.Options);
+        _compiledRegex = new PcreRegex(Case.Pattern, Case.Options | PcreOptions.Compiled);
+        _interpretedBuffer = _interpretedRegex.CreateMatchBuffer();
+        _compiledBuffer = _compiledRegex.CreateMatchBuffer();
+
+        _compiledBuffer8Bit = Case.Corpus == Corpus.Binary
+            ? new PcreRegex8Bit(CorpusBenchmarkData.Latin1Encoding.GetBytes(Case.Pattern), CorpusBenchmarkData.Latin1Encoding, Case.Options | PcreOptions.Compiled).CreateMatchBuffer()
+            : new PcreRegexUtf8(Case.Pattern, Case.Options | PcreOptions.Compiled).CreateMatchBuffer();
+
+        _regex = new Regex(Case.Pattern, RegexOptions.CultureInvariant);
+        _compiledRegexNet = new Regex(Case.Pattern, RegexOptions.CultureInvariant | RegexOptions.Compiled);
+#if NET
+        _nonBacktrackingRegex = new Regex(Case.Pattern, RegexOptions.CultureInvariant | RegexOptions.NonBacktracking);
+#endif
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _interpretedBuffer.Dispose();
+        _compiledBuffer.Dispose();
+        _compiledBuffer8Bit.Dispose();
+    }
+
+    [Benchmark]
+    public int Interpreter()
+    {
+        var count = 0;
+
+        foreach (var _ in _interpretedBuffer.Matches(_subject.AsSpan()))
+            ++count;
+
+        return count;
+    }
+
+    [Benchmark(Baseline = true)]
+    public int Jit()
+    {
+        var count = 0;
+
+        foreach (var _ in _compiledBuffer.Matches(_subject.AsSpan()))
+            ++count;
+
+        return count;
+    }
+
+    [Benchmark]
+    public int JitPlainApi()
+    {
+        var count = 0;
+
+        foreach (var _ in _compiledRegex.Matches(_subject))
+            ++count;
+
+        return count;
+    }
+
+    [Benchmark]
+    public int Jit8Bit()
+    {
+        var count = 0;
+
+        foreach (var _ in _compiledBuffer8Bit.Matches(_subjectBytes))
+            ++count;
+
+        return count;
+    }
+
+    [Benchmark]
+    public int Dfa()
+    {
+        // Dfa.Matches reports overlapping matches, so resume the search after the end of each match instead.
+        // The corpus is valid, and checking it on each call would make this loop quadratic.
+        var count = 0;
+        _dfaSettings.StartIndex = 0;
+
+        while (true)
+        {
+            var result = _interpretedRegex.Dfa.Match(_subject, _dfaSettings);
+            if (!result.Success)
+                return count;
+
+            ++count;
+
+            var endIndex = result.LongestMatch.EndIndex;
+            if (endIndex == result.Index && ++endIndex > _subject.Length)
+                return count;
+
+            _dfaSettings.StartIndex = endIndex;
+        }
+    }
+
+    [Benchmark]
+    public int NetRegex()
+        => Count(_regex, _subject);
+
+    [Benchmark]
+    public int NetRegexCompiled()
+        => Count(_compiledRegexNet, _subject);
+
+#if NET
+    [Benchmark]
+    public int NetRegexNonBacktracking()
+        => Count(_nonBacktrackingRegex, _subject);
+#endif
+
+    private static int Count(Regex regex, string subject)
+#if NET
+        => regex.Count(subject);
+#else
+        => regex.Matches(subject).Count;
+#endif
+}
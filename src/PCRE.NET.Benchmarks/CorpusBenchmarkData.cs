@@ -0,0 +1,223 @@
+﻿using System;
+using System.Diagnostics.CodeAnalysis;
+using System.Text;
+
+namespace PCRE.Benchmarks;
+
+public enum Corpus
+{
+    AccessLog,
+    Json,
+    SourceCode,
+    UnicodeText,
+    Binary
+}
+
+/// <summary>
+/// A pattern of the catalogue, along with the corpus it is matched against.
+/// </summary>
+/// <remarks>
+/// All the patterns use a syntax which has the same meaning in PCRE2 and .NET, so both engines should report the same match count.
+/// </remarks>
+public sealed class CorpusBenchmarkCase(string name, Corpus corpus, string pattern, PcreOptions options = PcreOptions.None)
+{
+    public string Name { get; } = name;
+    public Corpus Corpus { get; } = corpus;
+    public string Pattern { get; } = pattern;
+    public PcreOptions Options { get; } = options;
+
+    public override string ToString()
+        => $"{Corpus}/{Name}";
+}
+
+/// <summary>
+/// Generates the corpora of the cross-engine benchmarks, in the spirit of the rebar benchmark suite.
+/// </summary>
+/// <remarks>
+/// The corpora are generated from a fixed seed so that results are comparable between runs and machines.
+/// The binary corpus is exposed as a Latin-1 string so that each byte maps to a single code unit.
+/// </remarks>
+[SuppressMessage("ReSharper", "StringLiteralTypo")]
+internal static class CorpusBenchmarkData
+{
+    public const int CorpusSize = 1 << 20;
+
+    public static readonly Encoding Latin1Encoding = Encoding.GetEncoding("ISO-8859-1");
+
+    private static readonly string?[] _corpora = new string?[Enum.GetValues(typeof(Corpus)).Length];
+    private static readonly byte[]?[] _corporaBytes = new byte[]?[_corpora.Length];
+
+    public static readonly CorpusBenchmarkCase[] Cases =
+    [
+        new("literal", Corpus.AccessLog, "Googlebot"),
+        new("ipv4", Corpus.AccessLog, @"\b\d{1,3}\.\d{1,3}\.\d{1,3}\.\d{1,3}\b"),
+        new("request", Corpus.AccessLog, @"""(?:GET|POST|PUT|DELETE) ([^ ""]+) HTTP/1\.[01]"""),
+        new("server-error", Corpus.AccessLog, @""" 5\d\d \d+ "),
+        new("keys", Corpus.Json, @"""([a-z_]+)"":"),
+        new("email", Corpus.Json, @"[\w.+-]+@[\w-]+\.[\w.-]+"),
+        new("number", Corpus.Json, @"-?\d+(?:\.\d+)?(?:[eE][+-]?\d+)?"),
+        new("identifier", Corpus.SourceCode, @"\b[A-Za-z_][A-Za-z0-9_]*\b"),
+        new("keyword", Corpus.SourceCode, @"\b(?:if|else|for|while|return|switch|case|break|continue)\b"),
+        new("string-literal", Corpus.SourceCode, @"""(?:[^""\\\n]|\\.)*"""),
+        new("line-comment", Corpus.SourceCode, @"//[^\n]*"),
+        new("letters", Corpus.UnicodeText, @"\p{L}+"),
+        new("caseless-literal", Corpus.UnicodeText, @"(?i)sherlock"),
+        new("caseless-unicode", Corpus.UnicodeText, @"(?i)straße|σοφία|москва", PcreOptions.Ucp),
+        new("magic", Corpus.Binary, @"PK\x03\x04"),
+        new("ascii-run", Corpus.Binary, @"[\x20-\x7E]{8,}"),
+        new("email", Corpus.Binary, @"[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Za-z]{2,}")
+    ];
+
+    public static string GetCorpus(Corpus corpus)
+        => _corpora[(int)corpus] ??= Generate(corpus);
+
+    /// <summary>
+    /// Returns the corpus encoded for the 8-bit library: UTF-8 for text, and raw bytes for the binary corpus.
+    /// </summary>
+    public static byte[] GetCorpusBytes(Corpus corpus)
+        => _corporaBytes[(int)corpus] ??= (corpus == Corpus.Binary ? Latin1Encoding : Encoding.UTF8).GetBytes(GetCorpus(corpus));
+
+    public static int GetCorpusSizeInBytes(Corpus corpus)
+        => GetCorpusBytes(corpus).Length;
+
+    private static string Generate(Corpus corpus)
+    {
+        var random = new Random(42 + (int)corpus);
+        var sb = new StringBuilder(CorpusSize + 1024);
+
+        while (sb.Length < CorpusSize)
+        {
+            switch (corpus)
+            {
+                case Corpus.AccessLog:
+                    AppendAccessLogLine(sb, random);
+                    break;
+
+                case Corpus.Json:
+                    AppendJsonObject(sb, random);
+                    break;
+
+                case Corpus.SourceCode:
+                    AppendSourceCodeFunction(sb, random);
+                    break;
+
+                case Corpus.UnicodeText:
+                    AppendUnicodeSentence(sb, random);
+                    break;
+
+                case Corpus.Binary:
+                    AppendBinaryChunk(sb, random);
+                    break;
+
+                default:
+                    throw new ArgumentOutOfRangeException(nameof(corpus));
+            }
+        }
+
+        return sb.ToString(0, CorpusSize);
+    }
+
+    private static readonly string[] _httpMethods = ["GET", "GET", "GET", "POST", "PUT", "DELETE"];
+    private static readonly int[] _httpStatuses = [200, 200, 200, 200, 301, 304, 404, 500, 503];
+    private static readonly string[] _paths = ["/", "/index.html", "/api/v1/users", "/api/v1/orders", "/static/app.js", "/static/style.css", "/search", "/login"];
+    private static readonly string[] _userAgents =
+    [
+        "Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0 Safari/537.36",
+        "Mozilla/5.0 (X11; Linux x86_64; rv:121.0) Gecko/20100101 Firefox/121.0",
+        "Mozilla/5.0 (compatible; Googlebot/2.1; +http://www.google.com/bot.html)",
+        "curl/8.4.0"
+    ];
+
+    private static void AppendAccessLogLine(StringBuilder sb, Random random)
+    {
+        sb.Append(random.Next(1, 256)).Append('.').Append(random.Next(256)).Append('.').Append(random.Next(256)).Append('.').Append(random.Next(256));
+        sb.Append(" - - [").Append(random.Next(1, 29).ToString("00")).Append("/Oct/2024:").Append(random.Next(24).ToString("00")).Append(':').Append(random.Next(60).ToString("00")).Append(":00 +0000] \"");
+        sb.Append(Pick(random, _httpMethods)).Append(' ').Append(Pick(random, _paths));
+
+        if (random.Next(3) == 0)
+            sb.Append("?id=").Append(random.Next(100000));
+
+        sb.Append(" HTTP/1.1\" ").Append(Pick(random, _httpStatuses)).Append(' ').Append(random.Next(100, 50000));
+        sb.Append(" \"-\" \"").Append(Pick(random, _userAgents)).Append("\"\n");
+    }
+
+    private static readonly string[] _firstNames = ["alice", "bob", "carol", "dave", "eve", "mallory", "trent", "peggy"];
+    private static readonly string[] _domains = ["example.com", "mail.example.org", "corp.example.net"];
+    private static readonly string[] _tags = ["admin", "beta", "premium", "trial", "internal"];
+
+    private static void AppendJsonObject(StringBuilder sb, Random random)
+    {
+        var name = Pick(random, _firstNames);
+
+        sb.Append("{\"id\":").Append(random.Next(1000000));
+        sb.Append(",\"name\":\"").Append(name).Append('"');
+        sb.Append(",\"email\":\"").Append(name).Append('.').Append(random.Next(1000)).Append('@').Append(Pick(random, _domains)).Append('"');
+        sb.Append(",\"balance\":").Append(random.Next(-5000, 100000)).Append('.').Append(random.Next(100).ToString("00"));
+        sb.Append(",\"score\":").Append(random.Next(1, 10)).Append('.').Append(random.Next(1000)).Append("e-").Append(random.Next(1, 5));
+        sb.Append(",\"tags\":[\"").Append(Pick(random, _tags)).Append("\",\"").Append(Pick(random, _tags)).Append("\"]");
+        sb.Append(",\"address\":{\"street_name\":\"").Append(random.Next(1, 200)).Append(" Main St\",\"zip_code\":\"").Append(random.Next(10000, 99999)).Append("\"}");
+        sb.Append(",\"active\":").Append(random.Next(2) == 0 ? "true" : "false").Append("},\n");
+    }
+
+    private static readonly string[] _keywords = ["if", "else", "for", "while", "return", "switch", "case", "break", "continue"];
+    private static readonly string[] _identifiers = ["buffer", "length", "index", "result", "count", "node", "value", "context", "options", "match_data"];
+
+    private static void AppendSourceCodeFunction(StringBuilder sb, Random random)
+    {
+        sb.Append("// Computes the ").Append(Pick(random, _identifiers)).Append(" of the ").Append(Pick(random, _identifiers)).Append('\n');
+        sb.Append("static int compute_").Append(Pick(random, _identifiers)).Append(random.Next(1000)).Append("(const char* ").Append(Pick(random, _identifiers)).Append(", int ").Append(Pick(random, _identifiers)).Append(")\n{\n");
+
+        for (var i = random.Next(3, 10); i > 0; --i)
+        {
+            sb.Append("    ");
+
+            switch (random.Next(4))
+            {
+                case 0:
+                    sb.Append(Pick(random, _keywords)).Append(" (").Append(Pick(random, _identifiers)).Append(" < ").Append(random.Next(256)).Append(")\n");
+                    break;
+
+                case 1:
+                    sb.Append("log_message(\"unexpected ").Append(Pick(random, _identifiers)).Append(": \\\"%d\\\"\\n\", ").Append(Pick(random, _identifiers)).Append(");\n");
+                    break;
+
+                case 2:
+                    sb.Append(Pick(random, _identifiers)).Append(" += ").Append(Pick(random, _identifiers)).Append(" * 0x").Append(random.Next(4096).ToString("x")).Append("; // adjust\n");
+                    break;
+
+                default:
+                    sb.Append("return ").Append(Pick(random, _identifiers)).Append(";\n");
+                    break;
+            }
+        }
+
+        sb.Append("}\n\n");
+    }
+
+    private static readonly string[] _unicodeWords =
+    [
+        "Sherlock", "Holmes", "the", "detective", "of", "Baker", "street", "café", "déjà", "naïve", "Straße", "Größe",
+        "Σοφία", "φιλοσοφία", "λόγος", "Москва", "город", "книга", "東京", "日本語", "文字", "🙂", "🚀", "العربية", "हिन्दी"
+    ];
+
+    private static void AppendUnicodeSentence(StringBuilder sb, Random random)
+    {
+        for (var i = random.Next(5, 15); i > 0; --i)
+            sb.Append(Pick(random, _unicodeWords)).Append(' ');
+
+        sb.Append(random.Next(4) == 0 ? "SHERLOCK.\n" : ".\n");
+    }
+
+    private static readonly string[] _binaryStrings = ["PK\x03\x04", "kernel32.dll", "This program cannot be run in DOS mode", "support@example.com", "GetProcAddress", "libc.so.6"];
+
+    private static void AppendBinaryChunk(StringBuilder sb, Random random)
+    {
+        for (var i = random.Next(64, 512); i > 0; --i)
+            sb.Append((char)random.Next(256));
+
+        sb.Append(Pick(random, _binaryStrings));
+    }
+
+    private static T Pick<T>(Random random, T[] values)
+        => values[random.Next(values.Length)];
+}
@@ -0,0 +1,83 @@
+﻿using System.Collections.Generic;
+using System.Text.RegularExpressions;
+using BenchmarkDotNet.Attributes;
+using PCRE.Internal;
+
+namespace PCRE.Benchmarks;
+
+/// <summary>
+/// Measures the compile time and the first match latency of each pattern of the catalogue.
+/// </summary>
+/// <remarks>
+/// <see cref="PcreRegex"/> instances are cached, so the UTF-16 compile benchmarks create the internal regex directly.
+/// The JIT compile time is the difference between the <c>Jit</c> and <c>Interpreter</c> benchmarks.
+/// The first match latency includes the compilation, followed by a search for the first match in the corpus, which uses the uncached UTF-8 API.
+/// </remarks>
+[Config(typeof(NetCoreStandardConfig))]
+[MemoryDiagnoser]
+public class CorpusCompileBenchmark
+{
+    private PcreRegexSettings _interpretedSettings = null!;
+    private PcreRegexSettings _compiledSettings = null!;
+    private string _subject = null!;
+    private byte[] _subjectBytes = null!;
+
+    [ParamsSource(nameof(Cases))]
+    public CorpusBenchmarkCase Case { get; set; } = null!;
+
+    public static IEnumerable<CorpusBenchmarkCase> Cases => CorpusBenchmarkData.Cases;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _interpretedSettings = new PcreRegexSettings(Case.Options | PcreOptions.Utf);
+        _compiledSettings = new PcreRegexSettings(Case.Options | PcreOptions.Utf | PcreOptions.Compiled);
+
+        _subject = CorpusBenchmarkData.GetCorpus(Case.Corpus);
+        _subjectBytes = CorpusBenchmarkData.GetCorpusBytes(Case.Corpus);
+    }
+
+    [Benchmark(Baseline = true)]
+    public void CompileInterpreter()
+    {
+        using var regex = new InternalRegex16Bit(Case.Pattern, _interpretedSettings);
+    }
+
+    [Benchmark]
+    public void CompileJit()
+    {
+        using var regex = new InternalRegex16Bit(Case.Pattern, _compiledSettings);
+    }
+
+    [Benchmark]
+    public object Compile8Bit()
+        => new PcreRegexUtf8(Case.Pattern, Case.Options);
+
+    [Benchmark]
+    public object CompileJit8Bit()
+        => new PcreRegexUtf8(Case.Pattern, Case.Options | PcreOptions.Compiled);
+
+    [Benchmark]
+    public object CompileNetRegex()
+        => new Regex(Case.Pattern, RegexOptions.CultureInvariant);
+
+    [Benchmark]
+    public object CompileNetRegexCompiled()
+        => new Regex(Case.Pattern, RegexOptions.CultureInvariant | RegexOptions.Compiled);
+
+    [Benchmark]
+    public int FirstMatchInterpreter()
+        => new PcreRegexUtf8(Case.Pattern, Case.Options).Match(_subjectBytes).Index;
+
+    [Benchmark]
+    public int FirstMatchJit()
+        => new PcreRegexUtf8(Case.Pattern, Case.Options | PcreOptions.Compiled).Match(_subjectBytes).Index;
+
+    [Benchmark]
+    public int FirstMatchNetRegex()
+        => new Regex(Case.Pattern, RegexOptions.CultureInvariant).Match(_subject).Index;
+
+    [Benchmark]
+    public int FirstMatchNetRegexCompiled()
+        => new Regex(Case.Pattern, RegexOptions.CultureInvariant | RegexOptions.Compiled).Match(_subject).Index;
+}
@@ -0,0 +1,70 @@
+﻿using System;
+using System.Text;
+using System.Threading;
+using BenchmarkDotNet.Attributes;
+
+namespace PCRE.Benchmarks;
+
+[Config(typeof(NetCoreStandardConfig))]
+public class DeadlineBenchmark
+{
+    private string _subject = null!;
+
+    private PcreMatchBuffer _buffer = null!;
+    private PcreMatchBuffer _bufferMatchLimit = null!;
+    private PcreMatchBuffer _bufferTimeout = null!;
+    private PcreMatchBuffer _bufferCancellationToken = null!;
+
+    private CancellationTokenSource _cancellationTokenSource = null!;
+
+    [Params(PcreOptions.None, PcreOptions.Compiled)]
+    public PcreOptions Options { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // The match is at the end of the subject, so the pattern is tried at every position.
+
+        var sb = new StringBuilder();
+
+        while (sb.Length < 4096)
+            sb.Append("Lorem ipsum dolor sit amet, consectetur adipiscing elit. ");
+
+        sb.Append("contact: someone@example.com");
+        _subject = sb.ToString();
+
+        var regex = new PcreRegex(@"\b\w+@\w+\.com\b", Options);
+        _cancellationTokenSource = new CancellationTokenSource();
+
+        _buffer = regex.CreateMatchBuffer();
+        _bufferMatchLimit = regex.CreateMatchBuffer(new PcreMatchSettings { MatchLimit = 1_000_000 });
+        _bufferTimeout = regex.CreateMatchBuffer(new PcreMatchSettings { Timeout = TimeSpan.FromSeconds(10) });
+        _bufferCancellationToken = regex.CreateMatchBuffer(new PcreMatchSettings { CancellationToken = _cancellationTokenSource.Token });
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _buffer.Dispose();
+        _bufferMatchLimit.Dispose();
+        _bufferTimeout.Dispose();
+        _bufferCancellationToken.Dispose();
+        _cancellationTokenSource.Dispose();
+    }
+
+    [Benchmark(Baseline = true)]
+    public bool NoDeadline()
+        => _buffer.Match(_subject.AsSpan()).Success;
+
+    [Benchmark]
+    public bool MatchLimit()
+        => _bufferMatchLimit.Match(_subject.AsSpan()).Success;
+
+    [Benchmark]
+    public bool Timeout()
+        => _bufferTimeout.Match(_subject.AsSpan()).Success;
+
+    [Benchmark]
+    public bool CancellationToken()
+        => _bufferCancellationToken.Match(_subject.AsSpan()).Success;
+}
@@ -0,0 +1,52 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+
+namespace PCRE.Benchmarks;
+
+[Config(typeof(NetCoreStandardConfig))]
+public class FirstCodeUnitBenchmark
+{
+    private readonly PcreRegex _caseful = new(@"hello");
+    private readonly PcreRegex _caseless = new(@"(?i)hello");
+    private readonly PcreRegex _required = new(@"h.*z");
+
+    private PcreMatchBuffer _casefulBuffer = null!;
+    private PcreMatchBuffer _caselessBuffer = null!;
+    private PcreMatchBuffer _requiredBuffer = null!;
+
+    private string _subject = null!;
+
+    [Params(1024, 1 << 20)]
+    public int SubjectLength { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // The patterns are interpreted, and the first code unit only occurs at the end of the subject.
+        _subject = new string('0', SubjectLength - 5) + "Hello";
+
+        _casefulBuffer = _caseful.CreateMatchBuffer();
+        _caselessBuffer = _caseless.CreateMatchBuffer();
+        _requiredBuffer = _required.CreateMatchBuffer();
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _casefulBuffer.Dispose();
+        _caselessBuffer.Dispose();
+        _requiredBuffer.Dispose();
+    }
+
+    [Benchmark(Baseline = true)]
+    public bool Caseful()
+        => _casefulBuffer.Match(_subject.AsSpan()).Success;
+
+    [Benchmark]
+    public bool Caseless()
+        => _caselessBuffer.Match(_subject.AsSpan()).Success;
+
+    [Benchmark]
+    public bool RequiredCodeUnit()
+        => _requiredBuffer.Match(_subject.AsSpan()).Success;
+}
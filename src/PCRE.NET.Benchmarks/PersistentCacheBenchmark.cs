@@ -0,0 +1,46 @@
+﻿using System;
+using System.IO;
+using BenchmarkDotNet.Attributes;
+
+namespace PCRE.Benchmarks;
+
+[Config(typeof(NetCoreStandardConfig))]
+public class PersistentCacheBenchmark
+{
+    private const string _pattern = @"(?<user>[\w.+-]+)@(?<host>[\w-]+(?:\.[\w-]+)+)|(?<ip>\d{1,3}(?:\.\d{1,3}){3})|(?<date>\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2})";
+
+    private readonly byte[] _patternUtf8 = System.Text.Encoding.UTF8.GetBytes(_pattern);
+    private string _directory = null!;
+
+    [Params(PcreOptions.None, PcreOptions.Compiled)]
+    public PcreOptions Options { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _directory = Path.Combine(Path.GetTempPath(), "PCRE.NET.Benchmarks", Guid.NewGuid().ToString("N"));
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        PcrePersistentCache.Directory = null;
+
+        if (Directory.Exists(_directory))
+            Directory.Delete(_directory, true);
+    }
+
+    [Benchmark(Baseline = true)]
+    public object Compile()
+    {
+        PcrePersistentCache.Directory = null;
+        return new PcreRegexUtf8(_patternUtf8, Options);
+    }
+
+    [Benchmark]
+    public object LoadFromCache()
+    {
+        PcrePersistentCache.Directory = _directory;
+        return new PcreRegexUtf8(_patternUtf8, Options);
+    }
+}
@@ -0,0 +1,56 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+
+namespace PCRE.Benchmarks;
+
+[Config(typeof(NetCoreStandardConfig))]
+public class StartBitmapBenchmark
+{
+    private readonly PcreRegex _regex = new(@"[A-Za-z_]\w*=");
+    private readonly PcreRegex _regexCompiled = new(@"[A-Za-z_]\w*=", PcreOptions.Compiled);
+
+    private PcreMatchBuffer _buffer = null!;
+    private PcreMatchBuffer _bufferCompiled = null!;
+
+    private string _subject = null!;
+    private string _subjectMatchAtEnd = null!;
+
+    [Params(1024, 1 << 20)]
+    public int SubjectLength { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // None of the subject characters is in the start bitmap of the pattern.
+        _subject = new string('0', SubjectLength);
+
+        // The start bitmap is searched up to the match at the end of the subject.
+        _subjectMatchAtEnd = _subject + "a=";
+
+        _buffer = _regex.CreateMatchBuffer();
+        _bufferCompiled = _regexCompiled.CreateMatchBuffer();
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _buffer.Dispose();
+        _bufferCompiled.Dispose();
+    }
+
+    [Benchmark(Baseline = true)]
+    public bool Interpreted()
+        => _buffer.Match(_subject.AsSpan()).Success;
+
+    [Benchmark]
+    public bool Compiled()
+        => _bufferCompiled.Match(_subject.AsSpan()).Success;
+
+    [Benchmark]
+    public bool InterpretedMatchAtEnd()
+        => _buffer.Match(_subjectMatchAtEnd.AsSpan()).Success;
+
+    [Benchmark]
+    public bool CompiledMatchAtEnd()
+        => _bufferCompiled.Match(_subjectMatchAtEnd.AsSpan()).Success;
+}
@@ -0,0 +1,41 @@
+﻿using System.Globalization;
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+
+namespace PCRE.Benchmarks;
+
+/// <summary>
+/// Reports the throughput of the corpus benchmarks, in megabytes of UTF-8 input per second.
+/// </summary>
+internal class ThroughputColumn : IColumn
+{
+    public string Id => nameof(ThroughputColumn);
+    public string ColumnName => "MB/s";
+    public bool AlwaysShow => true;
+    public ColumnCategory Category => ColumnCategory.Custom;
+    public int PriorityInCategory => 0;
+    public bool IsNumeric => true;
+    public UnitType UnitType => UnitType.Dimensionless;
+    public string Legend => "Throughput in megabytes of UTF-8 input per second";
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase)
+        => GetValue(summary, benchmarkCase, summary.Style);
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase, SummaryStyle style)
+    {
+        var meanNanoseconds = summary[benchmarkCase]?.ResultStatistics?.Mean;
+
+        if (meanNanoseconds is not > 0 || benchmarkCase.Parameters["Case"] is not CorpusBenchmarkCase corpusCase)
+            return "-";
+
+        var megabytes = CorpusBenchmarkData.GetCorpusSizeInBytes(corpusCase.Corpus) / 1e6;
+        return (megabytes / (meanNanoseconds.Value / 1e9)).ToString("N1", style.CultureInfo ?? CultureInfo.InvariantCulture);
+    }
+
+    public bool IsDefault(Summary summary, BenchmarkCase benchmarkCase)
+        => false;
+
+    public bool IsAvailable(Summary summary)
+        => true;
+}
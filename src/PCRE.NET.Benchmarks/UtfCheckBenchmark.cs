@@ -0,0 +1,73 @@
+﻿using System;
+using System.Text;
+using BenchmarkDotNet.Attributes;
+
+namespace PCRE.Benchmarks;
+
+[Config(typeof(NetCoreStandardConfig))]
+public class UtfCheckBenchmark
+{
+    private readonly PcreRegex _regex = new(@"\d+", PcreOptions.Compiled);
+    private readonly PcreRegexUtf8 _regexUtf8 = new(@"\d+"u8, PcreOptions.Compiled);
+
+    private PcreMatchBuffer _buffer = null!;
+    private PcreMatchBuffer8Bit _bufferUtf8 = null!;
+
+    private string _subject = null!;
+    private byte[] _subjectUtf8 = null!;
+
+    [Params(1, 8)]
+    public int SubjectSizeInMegabytes { get; set; }
+
+    [Params(false, true)]
+    public bool NonAscii { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // The match is found at the start of the subject, so the cost is dominated by the UTF validity check.
+
+        var sb = new StringBuilder(SubjectSizeInMegabytes << 20);
+        sb.Append("42 ");
+
+        while (sb.Length < SubjectSizeInMegabytes << 20)
+            sb.Append(NonAscii ? "Lorem ipsum dolor sit amet, café déjà vu 😀. " : "Lorem ipsum dolor sit amet, consectetur adipiscing. ");
+
+        _subject = sb.ToString();
+        _subjectUtf8 = Encoding.UTF8.GetBytes(_subject);
+
+        _buffer = _regex.CreateMatchBuffer();
+        _bufferUtf8 = _regexUtf8.CreateMatchBuffer();
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _buffer.Dispose();
+        _bufferUtf8.Dispose();
+    }
+
+    [Benchmark(Baseline = true)]
+    public bool Utf16()
+        => _buffer.Match(_subject.AsSpan()).Success;
+
+    [Benchmark]
+    public bool Utf16NoUtfCheck()
+        => _buffer.Match(_subject.AsSpan(), PcreMatchOptions.NoUtfCheck).Success;
+
+    [Benchmark]
+    public bool Utf16IsValidUtf()
+        => PcreRegex.IsValidUtf(_subject.AsSpan());
+
+    [Benchmark]
+    public bool Utf8()
+        => _bufferUtf8.Match(_subjectUtf8).Success;
+
+    [Benchmark]
+    public bool Utf8NoUtfCheck()
+        => _bufferUtf8.Match(_subjectUtf8, PcreMatchOptions.NoUtfCheck).Success;
+
+    [Benchmark]
+    public bool Utf8IsValidUtf()
+        => PcreRegexUtf8.IsValidUtf(_subjectUtf8);
+}
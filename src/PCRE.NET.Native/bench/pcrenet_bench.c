@@ -0,0 +1,414 @@
+// Standalone benchmark of the native exports, which measures the native layer without the .NET interop and GC noise.
+// This translation unit includes the 8-bit sources which define the input and output structures of the exports,
+// so the executable is built from the same sources as the library, except for the corresponding 8-bit wrappers.
+
+#include "../compile/config.8bit.h"
+
+#include "../pcrenet_compile.c"
+#include "../pcrenet_match.c"
+#include "../pcrenet_substitute.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MIN_SUBJECT_LENGTH (1u << 20)
+#define DEFAULT_ITERATIONS 10
+#define DFA_WORKSPACE_SIZE 1000
+
+static const char replacement[] = "[$0]";
+
+typedef struct
+{
+    uint8_t* data;
+    uint32_t length;
+} bench_buffer;
+
+typedef struct
+{
+    const char* operation;
+    uint64_t total_time; // In nanoseconds
+    uint32_t iterations;
+    uint32_t match_count;
+} bench_result;
+
+static int read_file(const char* path, bench_buffer* buffer)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return 0;
+
+    size_t capacity = 4096;
+    size_t length = 0;
+    uint8_t* data = malloc(capacity);
+
+    while (data)
+    {
+        length += fread(data + length, 1, capacity - length, file);
+
+        if (length < capacity)
+            break;
+
+        capacity *= 2;
+        uint8_t* new_data = realloc(data, capacity);
+
+        if (!new_data)
+            free(data);
+
+        data = new_data;
+    }
+
+    const int error = ferror(file);
+    fclose(file);
+
+    if (!data || error)
+    {
+        free(data);
+        return 0;
+    }
+
+    buffer->data = data;
+    buffer->length = (uint32_t)length;
+    return 1;
+}
+
+static int repeat_subject(bench_buffer* subject, const uint32_t min_length)
+{
+    // Small inputs are repeated so that each iteration runs long enough to be measured reliably.
+
+    if (subject->length == 0 || subject->length >= min_length)
+        return 1;
+
+    const uint32_t count = (min_length + subject->length - 1) / subject->length;
+    uint8_t* data = malloc((size_t)subject->length * count);
+
+    if (!data)
+        return 0;
+
+    for (uint32_t i = 0; i < count; ++i)
+        memcpy(data + (size_t)i * subject->length, subject->data, subject->length);
+
+    free(subject->data);
+    subject->data = data;
+    subject->length *= count;
+    return 1;
+}
+
+static void init_compile_input(pcrenet_compile_input* input, const uint8_t* pattern, const uint32_t length, const uint32_t jit)
+{
+    memset(input, 0, sizeof(pcrenet_compile_input));
+    input->pattern = pattern;
+    input->pattern_length = length;
+    input->flags_jit = jit ? PCRE2_JIT_COMPLETE : 0;
+    input->max_var_lookbehind = MAX_VARLOOKBEHIND;
+}
+
+static void bench_compile(bench_result* result, const pcrenet_compile_input* input, const uint32_t iterations)
+{
+    result->operation = "compile";
+    result->iterations = iterations;
+    result->match_count = 0;
+
+    const uint64_t start = pcrenet_get_timestamp();
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        pcrenet_compile_result compile_result;
+        pcrenet_compile_8(input, &compile_result);
+        pcrenet_code_free_8(compile_result.code);
+    }
+
+    result->total_time = pcrenet_get_timestamp() - start;
+}
+
+static uint32_t next_start_index(const size_t* output_vector)
+{
+    // Resume after the match, and skip a code unit after an empty match.
+    return (uint32_t)(output_vector[1] > output_vector[0] ? output_vector[1] : output_vector[1] + 1);
+}
+
+static void bench_match(bench_result* result, pcre2_code* code, const bench_buffer* subject, size_t* output_vector, const uint32_t iterations)
+{
+    result->operation = "match";
+    result->iterations = iterations;
+    result->match_count = 0;
+
+    pcrenet_match_input input;
+    memset(&input, 0, sizeof(input));
+    input.code = code;
+    input.subject = subject->data;
+    input.subject_length = subject->length;
+    input.output_vector = output_vector;
+
+    const uint64_t start = pcrenet_get_timestamp();
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        pcrenet_match_result match_result;
+        input.start_index = 0;
+
+        while (input.start_index <= subject->length)
+        {
+            pcrenet_match_8(&input, &match_result);
+
+            if (match_result.result_code < 0)
+                break;
+
+            ++result->match_count;
+            input.start_index = next_start_index(output_vector);
+        }
+    }
+
+    result->total_time = pcrenet_get_timestamp() - start;
+}
+
+static void bench_buffer_match(bench_result* result, pcre2_code* code, const bench_buffer* subject, const uint32_t iterations)
+{
+    result->operation = "buffer_match";
+    result->iterations = iterations;
+    result->match_count = 0;
+    result->total_time = 0;
+
+    match_buffer_info info;
+    memset(&info, 0, sizeof(info));
+    info.code = code;
+
+    match_buffer* buffer = pcrenet_create_match_buffer_8(&info);
+    if (!buffer)
+        return;
+
+    pcrenet_buffer_match_input input;
+    memset(&input, 0, sizeof(input));
+    input.buffer = buffer;
+    input.subject = subject->data;
+    input.subject_length = subject->length;
+
+    const uint64_t start = pcrenet_get_timestamp();
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        pcrenet_match_result match_result;
+        input.start_index = 0;
+
+        while (input.start_index <= subject->length)
+        {
+            pcrenet_buffer_match_8(&input, &match_result);
+
+            if (match_result.result_code < 0)
+                break;
+
+            ++result->match_count;
+            input.start_index = next_start_index(info.output_vector);
+        }
+    }
+
+    result->total_time = pcrenet_get_timestamp() - start;
+    pcrenet_free_match_buffer_8(buffer);
+}
+
+static void bench_dfa_match(bench_result* result, pcre2_code* code, const bench_buffer* subject, const uint32_t iterations)
+{
+    result->operation = "dfa_match";
+    result->iterations = iterations;
+    result->match_count = 0;
+
+    // Only the longest match at each position is needed to resume the search.
+    size_t output_vector[2];
+
+    pcrenet_dfa_match_input input;
+    memset(&input, 0, sizeof(input));
+    input.code = code;
+    input.subject = subject->data;
+    input.subject_length = subject->length;
+    input.output_vector = output_vector;
+    input.max_results = 1;
+    input.workspace_size = DFA_WORKSPACE_SIZE;
+
+    const uint64_t start = pcrenet_get_timestamp();
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        pcrenet_match_result match_result;
+        input.start_index = 0;
+
+        while (input.start_index <= subject->length)
+        {
+            pcrenet_dfa_match_8(&input, &match_result);
+
+            if (match_result.result_code < 0)
+                break;
+
+            ++result->match_count;
+            input.start_index = next_start_index(output_vector);
+        }
+    }
+
+    result->total_time = pcrenet_get_timestamp() - start;
+}
+
+static void bench_substitute(bench_result* result, pcre2_code* code, const bench_buffer* subject, PCRE2_UCHAR* output, const uint32_t output_length, const uint32_t iterations)
+{
+    result->operation = "substitute";
+    result->iterations = iterations;
+    result->match_count = 0;
+
+    pcrenet_substitute_input input;
+    memset(&input, 0, sizeof(input));
+    input.code = code;
+    input.subject = subject->data;
+    input.subject_length = subject->length;
+    input.additional_options = PCRE2_SUBSTITUTE_GLOBAL;
+    input.replacement = (PCRE2_SPTR)replacement;
+    input.replacement_length = sizeof(replacement) - 1;
+    input.buffer = output;
+    input.buffer_length = output_length;
+
+    const uint64_t start = pcrenet_get_timestamp();
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        pcrenet_substitute_result substitute_result;
+        pcrenet_substitute_8(&input, &substitute_result);
+
+        if (substitute_result.result_code > 0)
+            result->match_count += (uint32_t)substitute_result.result_code;
+
+        pcrenet_substitute_result_free_8(&substitute_result);
+    }
+
+    result->total_time = pcrenet_get_timestamp() - start;
+}
+
+static void print_result(const char* mode, const bench_result* result, const uint32_t subject_length)
+{
+    const double time_per_iteration = result->iterations ? (double)result->total_time / result->iterations : 0;
+
+    printf("  %-7s %-13s %14.1f us", mode, result->operation, time_per_iteration / 1e3);
+
+    if (subject_length && time_per_iteration > 0)
+        printf(" %10.1f MB/s %9u matches", subject_length / (time_per_iteration / 1e9) / 1e6, result->match_count / result->iterations);
+
+    printf("\n");
+}
+
+static void bench_pattern(const uint8_t* pattern, const uint32_t pattern_length, const bench_buffer* subject, PCRE2_UCHAR* output, const uint32_t output_length, const uint32_t iterations)
+{
+    printf("%.*s\n", (int)pattern_length, (const char*)pattern);
+
+    for (uint32_t jit = 0; jit <= 1; ++jit)
+    {
+        const char* mode = jit ? "jit" : "interp";
+
+        pcrenet_compile_input compile_input;
+        init_compile_input(&compile_input, pattern, pattern_length, jit);
+
+        pcrenet_compile_result compile_result;
+        pcrenet_compile_8(&compile_input, &compile_result);
+
+        if (!compile_result.code)
+        {
+            printf("  %-7s compile error %d at offset %u\n", mode, compile_result.error_code, compile_result.error_offset);
+            return;
+        }
+
+        bench_result result;
+
+        // Compile 10 times more often than matching, as it is much faster than scanning the subject.
+        bench_compile(&result, &compile_input, iterations * 10);
+        print_result(mode, &result, 0);
+
+        size_t* output_vector = malloc(2 * (compile_result.capture_count + 1) * sizeof(size_t));
+
+        if (output_vector)
+        {
+            bench_match(&result, compile_result.code, subject, output_vector, iterations);
+            print_result(mode, &result, subject->length);
+            free(output_vector);
+        }
+
+        bench_buffer_match(&result, compile_result.code, subject, iterations);
+        print_result(mode, &result, subject->length);
+
+        if (!jit)
+        {
+            // The DFA algorithm is never JIT-compiled.
+            bench_dfa_match(&result, compile_result.code, subject, iterations);
+            print_result("dfa", &result, subject->length);
+        }
+
+        bench_substitute(&result, compile_result.code, subject, output, output_length, iterations);
+        print_result(mode, &result, subject->length);
+
+        pcrenet_code_free_8(compile_result.code);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3 || argc > 4)
+    {
+        fprintf(stderr, "Usage: %s <pattern file> <subject file> [iterations]\n", argv[0]);
+        fprintf(stderr, "The pattern file contains one pattern per line, for instance PCRE/testdata/greplist.\n");
+        return 2;
+    }
+
+    const uint32_t iterations = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 10) : DEFAULT_ITERATIONS;
+
+    if (iterations == 0)
+    {
+        fprintf(stderr, "Invalid iteration count: %s\n", argv[3]);
+        return 2;
+    }
+
+    bench_buffer patterns;
+    bench_buffer subject;
+
+    if (!read_file(argv[1], &patterns))
+    {
+        fprintf(stderr, "Could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    if (!read_file(argv[2], &subject) || !repeat_subject(&subject, MIN_SUBJECT_LENGTH))
+    {
+        fprintf(stderr, "Could not read %s\n", argv[2]);
+        free(patterns.data);
+        return 1;
+    }
+
+    // The output buffer is large enough for most substitutions, so the timings measure a single pass.
+    const uint32_t output_length = 2 * subject.length;
+    PCRE2_UCHAR* output = malloc(output_length);
+
+    if (!output)
+    {
+        free(patterns.data);
+        free(subject.data);
+        return 1;
+    }
+
+    printf("Subject: %s, %u bytes, %u iterations\n\n", argv[2], subject.length, iterations);
+
+    for (uint32_t line_start = 0; line_start < patterns.length;)
+    {
+        uint32_t line_end = line_start;
+
+        while (line_end < patterns.length && patterns.data[line_end] != '\n')
+            ++line_end;
+
+        uint32_t pattern_length = line_end - line_start;
+
+        if (pattern_length && patterns.data[line_end - 1] == '\r')
+            --pattern_length;
+
+        if (pattern_length)
+            bench_pattern(patterns.data + line_start, pattern_length, &subject, output, output_length, iterations);
+
+        line_start = line_end + 1;
+    }
+
+    free(output);
+    free(patterns.data);
+    free(subject.data);
+    return 0;
+}
@@ -2,3 +2,5 @@
 #include "config.16bit.h"
 
 #include "../../PCRE/src/pcre2_jit_compile.c"
+#include "../pcrenet_jit_class_span_inc.h"
+#include "../pcrenet_jit_compile_inc.h"
@@ -0,0 +1,4 @@
+
+#include "config.8bit.h"
+
+#include "../../PCRE/src/pcre2_serialize.c"
@@ -0,0 +1,4 @@
+
+#include "config.16bit.h"
+
+#include "../pcrenet_prefilter.c"
@@ -0,0 +1,4 @@
+
+#include "config.8bit.h"
+
+#include "../pcrenet_utf.c"
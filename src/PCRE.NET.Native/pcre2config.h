@@ -47,3 +47,23 @@
 #error "Unexpected compiler"
 
 #endif
+
+/* JIT executable memory allocator, see pcrenet_jit_alloc.c */
+
+#if defined(__linux__) && !defined(PCRENET_NO_JIT_ALLOCATOR)
+
+#include <stddef.h>
+
+#define PCRENET_JIT_ALLOCATOR 1
+
+/* The sljit allocator is kept as the default one */
+#define SLJIT_MALLOC_EXEC(size, exec_allocator_data) \
+    (pcrenet_jit_use_arenas() ? pcrenet_jit_alloc(size) : SLJIT_BUILTIN_MALLOC_EXEC((size), (exec_allocator_data)))
+#define SLJIT_FREE_EXEC(ptr, exec_allocator_data) \
+    (pcrenet_jit_use_arenas() ? pcrenet_jit_free(ptr) : SLJIT_BUILTIN_FREE_EXEC((ptr), (exec_allocator_data)))
+
+int pcrenet_jit_use_arenas(void);
+void* pcrenet_jit_alloc(size_t size);
+void pcrenet_jit_free(void* ptr);
+
+#endif
@@ -35,6 +35,11 @@
 
 // Common types and functions
 
+// A callout filter is a flat array: a bitmap of the numeric callouts to forward,
+// followed by the count of string callouts to forward and their sorted pattern offsets.
+#define PCRENET_CALLOUT_FILTER_NUMBERS_SIZE 8
+#define PCRENET_CALLOUT_FILTER_HEADER_SIZE (PCRENET_CALLOUT_FILTER_NUMBERS_SIZE + 1)
+
 typedef struct
 {
     uint32_t match_limit;
@@ -42,6 +47,84 @@ typedef struct
     uint32_t heap_limit;
     uint32_t offset_limit;
     pcre2_jit_stack* jit_stack;
+    uint64_t timeout; // In nanoseconds, zero for none
+    const volatile int32_t* cancellation_flag;
+    uint32_t auto_callouts;
+    const uint32_t* callout_filter; // NULL to forward all callouts
+    uint32_t collect_stats; // Only used by match buffers
+    uint32_t collect_profile; // Only used by match buffers
 } match_settings;
 
 void PCRENET_SUFFIX(apply_settings)(const match_settings* settings, pcre2_match_context* context);
+int PCRENET_SUFFIX(valid_utf)(PCRE2_SPTR subject, PCRE2_SIZE length, PCRE2_SIZE* error_offset);
+int PCRENET_SUFFIX(check_match_utf)(const pcre2_code* code, PCRE2_SPTR subject, PCRE2_SIZE length, PCRE2_SIZE start_offset, uint32_t* options);
+int PCRENET_SUFFIX(callout_filter_accepts)(const uint32_t* filter, const pcre2_callout_block* block);
+int PCRENET_SUFFIX(can_match)(const pcre2_code* code, PCRE2_SPTR subject, PCRE2_SIZE length, PCRE2_SIZE* start_offset, uint32_t options, const pcre2_match_context* context);
+
+// Match deadlines
+
+uint64_t pcrenet_get_timestamp(void); // In nanoseconds, from a monotonic clock
+
+#define PCRENET_ERROR_TIMEOUT (-1001)
+#define PCRENET_ERROR_CANCELLED (-1002)
+
+// Number of steps counted towards the match limit between two deadline checks.
+// The DFA matcher counts a step per start position, and each of them may scan the rest of the subject.
+#define PCRENET_DEADLINE_CHECK_INTERVAL 4096
+#define PCRENET_DFA_DEADLINE_CHECK_INTERVAL 1
+
+typedef struct match_deadline
+{
+    uint64_t deadline;
+    const volatile int32_t* cancellation_flag;
+    const void* owner; // The callout data of the match, which identifies it when the match limit is reached
+    const void* start; // Start of the current match attempt
+    uint32_t match_limit; // The actual match limit
+    uint32_t check_interval;
+    uint32_t initial_steps; // The match limit given to PCRE2
+    uint32_t granted_steps;
+    struct match_deadline* previous; // Enclosing match with a deadline on the same thread
+} match_deadline;
+
+int pcrenet_deadline_init(match_deadline* deadline, const match_settings* settings);
+uint32_t pcrenet_deadline_enter(match_deadline* deadline, const void* owner, uint32_t match_limit, uint32_t check_interval);
+void pcrenet_deadline_leave(const match_deadline* deadline);
+int pcrenet_deadline_check(const match_deadline* deadline);
+int pcrenet_match_limit_reached(const void* callout_data, const void* start); // Called by the patched PCRE2 matchers
+const char* pcrenet_deadline_error_message(int32_t error_code);
+void PCRENET_SUFFIX(deadline_enter)(match_deadline* deadline, const void* owner, const pcre2_code* code, const match_settings* settings, pcre2_match_context* context, uint32_t check_interval);
+
+// JIT executable memory
+
+#define PCRENET_JIT_MEMORY_CUSTOM_ALLOCATOR 0x01
+#define PCRENET_JIT_MEMORY_HUGE_PAGES 0x02
+
+typedef struct
+{
+    uint64_t reserved_size;
+    uint64_t allocated_size;
+    uint64_t allocation_count;
+    uint64_t region_count;
+    uint32_t flags;
+} pcrenet_jit_memory_stats;
+
+void pcrenet_jit_memory_get_stats(pcrenet_jit_memory_stats* stats);
+void pcrenet_jit_memory_set_huge_pages(int enabled);
+int pcrenet_jit_memory_enable_custom_allocator(void);
+void pcrenet_jit_memory_trim(void);
+
+void jit_builtin_memory_stats_8(pcrenet_jit_memory_stats* stats);
+void jit_builtin_memory_stats_16(pcrenet_jit_memory_stats* stats);
+
+int PCRENET_SUFFIX(get_jit_code)(const pcre2_code* code, uint32_t mode_index, void** address, size_t* size);
+
+// JIT code profiling
+
+#define PCRENET_JIT_PROFILING_PERF_MAP 0x01
+#define PCRENET_JIT_PROFILING_GDB 0x02
+
+uint32_t pcrenet_jit_profiling_get_supported_flags(void);
+uint32_t pcrenet_jit_profiling_get_flags(void);
+void pcrenet_jit_profiling_set_flags(uint32_t flags);
+void pcrenet_jit_profiling_register(const void* address, size_t size, const char* name);
+void pcrenet_jit_profiling_unregister(const void* address);
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "pcrenet_simd.h"
+
+// Vectorized scans for the first code unit of a subject which is in a 256-bit class bitmap, as found in the compiled patterns.
+// Code units above 255 are looked up as 255, so bit 255 stands for all of them in the 16-bit library.
+// This header is compiled for each code unit width.
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+#   define BITMAP_INDEX(c) (c)
+#else
+#   define BITMAP_INDEX(c) ((c) > 255 ? 255 : (c))
+#endif
+
+#define IN_BITMAP(bitmap, c) (((bitmap)[BITMAP_INDEX(c) / 8] & (1u << (BITMAP_INDEX(c) & 7))) != 0)
+
+// Builds the nibble tables of the "truffle" algorithm: for a code unit c, the bit (c >> 4) & 7 of
+// low_table[c & 0xf] (when c < 0x80) or high_table[c & 0xf] (when c >= 0x80) is set if c is in the bitmap.
+static void build_bitmap_tables(const uint8_t* bitmap, uint8_t* low_table, uint8_t* high_table)
+{
+    for (uint32_t low_nibble = 0; low_nibble < 16; ++low_nibble)
+    {
+        uint8_t low = 0;
+        uint8_t high = 0;
+
+        for (uint32_t high_nibble = 0; high_nibble < 8; ++high_nibble)
+        {
+            if ((bitmap[high_nibble * 2 + low_nibble / 8] >> (low_nibble & 7)) & 1)
+                low |= (uint8_t)(1u << high_nibble);
+
+            if ((bitmap[(high_nibble + 8) * 2 + low_nibble / 8] >> (low_nibble & 7)) & 1)
+                high |= (uint8_t)(1u << high_nibble);
+        }
+
+        low_table[low_nibble] = low;
+        high_table[low_nibble] = high;
+    }
+}
+
+#if PCRENET_SSE2
+
+PCRENET_TARGET_SSSE3
+static PCRE2_SPTR find_in_bitmap_ssse3(PCRE2_SPTR ptr, PCRE2_SPTR end, const uint8_t* low_table, const uint8_t* high_table)
+{
+    const __m128i low_lookup = _mm_loadu_si128((const __m128i*)low_table);
+    const __m128i high_lookup = _mm_loadu_si128((const __m128i*)high_table);
+    const __m128i bit_lookup = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    const __m128i high_bit = _mm_set1_epi8((char)0x80);
+    const __m128i zero = _mm_setzero_si128();
+
+#if PCRE2_CODE_UNIT_WIDTH == 16
+    const __m128i high_byte_mask = _mm_set1_epi16((short)0xff00);
+    const __m128i max_unit = _mm_set1_epi16(0xff);
+#endif
+
+    while (end - ptr >= 16)
+    {
+#if PCRE2_CODE_UNIT_WIDTH == 8
+        const __m128i data = _mm_loadu_si128((const __m128i*)ptr);
+#else
+        // Clamp to 255 as in pcre2_match, then narrow to bytes
+        const __m128i first = _mm_loadu_si128((const __m128i*)ptr);
+        const __m128i second = _mm_loadu_si128((const __m128i*)(ptr + 8));
+        const __m128i first_small = _mm_cmpeq_epi16(_mm_and_si128(first, high_byte_mask), zero);
+        const __m128i second_small = _mm_cmpeq_epi16(_mm_and_si128(second, high_byte_mask), zero);
+        const __m128i data = _mm_packus_epi16(
+            _mm_or_si128(_mm_and_si128(first, first_small), _mm_andnot_si128(first_small, max_unit)),
+            _mm_or_si128(_mm_and_si128(second, second_small), _mm_andnot_si128(second_small, max_unit))
+        );
+#endif
+
+        const __m128i rows = _mm_or_si128(
+            _mm_shuffle_epi8(low_lookup, data),
+            _mm_shuffle_epi8(high_lookup, _mm_xor_si128(data, high_bit))
+        );
+
+        const __m128i bits = _mm_shuffle_epi8(bit_lookup, _mm_and_si128(_mm_srli_epi16(data, 4), nibble_mask));
+        const uint32_t mask = ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(rows, bits), zero)) & 0xffff;
+
+        if (mask)
+            return ptr + pcrenet_ctz(mask);
+
+        ptr += 16;
+    }
+
+    return ptr;
+}
+
+#elif PCRENET_NEON
+
+static PCRE2_SPTR find_in_bitmap_neon(PCRE2_SPTR ptr, PCRE2_SPTR end, const uint8_t* low_table, const uint8_t* high_table)
+{
+    static const uint8_t bit_table[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+
+    const uint8x16_t low_lookup = vld1q_u8(low_table);
+    const uint8x16_t high_lookup = vld1q_u8(high_table);
+    const uint8x16_t bit_lookup = vld1q_u8(bit_table);
+    const uint8x16_t index_mask = vdupq_n_u8(0x8f);
+    const uint8x16_t high_bit = vdupq_n_u8(0x80);
+
+    while (end - ptr >= 16)
+    {
+#if PCRE2_CODE_UNIT_WIDTH == 8
+        const uint8x16_t data = vld1q_u8(ptr);
+#else
+        const uint16x8_t max_unit = vdupq_n_u16(0xff);
+        const uint8x16_t data = vcombine_u8(
+            vmovn_u16(vminq_u16(vld1q_u16(ptr), max_unit)),
+            vmovn_u16(vminq_u16(vld1q_u16(ptr + 8), max_unit))
+        );
+#endif
+
+        // Out of range indices yield zero, so each table only sees the code units of its half
+        const uint8x16_t rows = vorrq_u8(
+            vqtbl1q_u8(low_lookup, vandq_u8(data, index_mask)),
+            vqtbl1q_u8(high_lookup, vandq_u8(veorq_u8(data, high_bit), index_mask))
+        );
+
+        const uint8x16_t bits = vqtbl1q_u8(bit_lookup, vshrq_n_u8(data, 4));
+
+        if (vmaxvq_u8(vandq_u8(rows, bits)))
+            break;
+
+        ptr += 16;
+    }
+
+    return ptr;
+}
+
+#endif
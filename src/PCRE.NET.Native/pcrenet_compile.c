@@ -1,4 +1,6 @@
+#include <stdio.h>
 #include "pcrenet.h"
+#include "../PCRE/src/pcre2_internal.h"
 
 c_static_assert(sizeof(uint32_t) <= sizeof(PCRE2_SIZE), "Parameter size must fit into PCRE2_SIZE");
 
@@ -17,6 +19,8 @@ typedef struct
     uint32_t max_pattern_compiled_length;
     uint32_t optimization_directives_count;
     uint32_t* optimization_directives;
+    const uint8_t* serialized_code;
+    uint32_t serialized_code_size;
 } pcrenet_compile_input;
 
 typedef struct
@@ -28,8 +32,85 @@ typedef struct
     uint32_t name_count;
     uint32_t name_entry_size;
     PCRE2_SPTR name_entry_table;
+    uint32_t deserialized;
+    int32_t jit_error_code;
+    uint64_t jit_duration; // In nanoseconds
 } pcrenet_compile_result;
 
+static pcre2_code* decode_code(const uint8_t* bytes, const uint32_t size)
+{
+    // pcre2_serialize_decode trusts the block sizes stored in the data, so validate them beforehand.
+
+    const size_t header_size = sizeof(pcre2_serialized_data) + TABLES_LENGTH;
+    if (!bytes || size < header_size + sizeof(pcre2_real_code))
+        return NULL;
+
+    pcre2_serialized_data header;
+    memcpy(&header, bytes, sizeof(header));
+
+    if (header.number_of_codes != 1)
+        return NULL;
+
+    CODE_BLOCKSIZE_TYPE block_size;
+    memcpy(&block_size, bytes + header_size + offsetof(pcre2_real_code, blocksize), sizeof(block_size));
+
+    if (block_size != size - header_size)
+        return NULL;
+
+    pcre2_code* code;
+    return pcre2_serialize_decode(&code, 1, bytes, NULL) == 1 ? code : NULL;
+}
+
+static const char* const jit_mode_names[] = { "", ":partial-soft", ":partial-hard" };
+
+#define JIT_MODE_COUNT (sizeof(jit_mode_names) / sizeof(jit_mode_names[0]))
+
+static void register_jit_code(const pcre2_code* code, PCRE2_SPTR pattern, const uint32_t pattern_length)
+{
+    // Name the code after the pattern, so it can be identified in profilers.
+    // The hash distinguishes patterns which only differ after the excerpt.
+
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < pattern_length; ++i)
+        hash = (hash ^ pattern[i]) * 16777619u;
+
+    char excerpt[81];
+    uint32_t excerpt_length = 0;
+
+    for (; excerpt_length < pattern_length && excerpt_length < sizeof(excerpt) - 1; ++excerpt_length)
+    {
+        const PCRE2_UCHAR c = pattern[excerpt_length];
+        excerpt[excerpt_length] = c >= 0x20 && c < 0x7f ? (char)c : '?';
+    }
+
+    excerpt[excerpt_length] = 0;
+
+    for (uint32_t mode = 0; mode < JIT_MODE_COUNT; ++mode)
+    {
+        void* address;
+        size_t size;
+
+        if (!PCRENET_SUFFIX(get_jit_code)(code, mode, &address, &size))
+            continue;
+
+        char name[160];
+        snprintf(name, sizeof(name), "pcre2:%08x%s:%s%s", hash, jit_mode_names[mode], excerpt, excerpt_length < pattern_length ? "..." : "");
+        pcrenet_jit_profiling_register(address, size, name);
+    }
+}
+
+static void unregister_jit_code(const pcre2_code* code)
+{
+    for (uint32_t mode = 0; mode < JIT_MODE_COUNT; ++mode)
+    {
+        void* address;
+        size_t size;
+
+        if (PCRENET_SUFFIX(get_jit_code)(code, mode, &address, &size))
+            pcrenet_jit_profiling_unregister(address);
+    }
+}
+
 PCRENET_EXPORT(void, compile)(const pcrenet_compile_input* input, pcrenet_compile_result* result)
 {
     pcre2_compile_context* context = pcre2_compile_context_create(NULL);
@@ -61,21 +142,39 @@ PCRENET_EXPORT(void, compile)(const pcrenet_compile_input* input, pcrenet_compil
     int error_code;
     PCRE2_SIZE error_offset;
 
-    result->code = pcre2_compile(
-        input->pattern,
-        input->pattern_length,
-        input->flags,
-        &error_code,
-        &error_offset,
-        context
-    );
+    result->code = input->serialized_code
+        ? decode_code(input->serialized_code, input->serialized_code_size)
+        : NULL;
+
+    result->deserialized = result->code != NULL;
+    result->jit_error_code = 0;
+    result->jit_duration = 0;
+
+    if (!result->code)
+    {
+        result->code = pcre2_compile(
+            input->pattern,
+            input->pattern_length,
+            input->flags,
+            &error_code,
+            &error_offset,
+            context
+        );
+    }
 
     if (result->code)
     {
         result->error_code = 0;
 
         if (input->flags_jit)
-            pcre2_jit_compile(result->code, input->flags_jit);
+        {
+            const uint64_t jit_start = pcrenet_get_timestamp();
+            result->jit_error_code = pcre2_jit_compile(result->code, input->flags_jit);
+            result->jit_duration = pcrenet_get_timestamp() - jit_start;
+
+            if (result->jit_error_code == 0 && pcrenet_jit_profiling_get_flags())
+                register_jit_code(result->code, input->pattern, input->pattern_length);
+        }
 
         pcre2_pattern_info(result->code, PCRE2_INFO_CAPTURECOUNT, &result->capture_count);
         pcre2_pattern_info(result->code, PCRE2_INFO_NAMECOUNT, &result->name_count);
@@ -91,8 +190,35 @@ PCRENET_EXPORT(void, compile)(const pcrenet_compile_input* input, pcrenet_compil
     pcre2_compile_context_free(context);
 }
 
+PCRENET_EXPORT(int32_t, serialize_code)(const pcre2_code* code, uint8_t** bytes, uint32_t* size)
+{
+    PCRE2_SIZE serialized_size;
+    const int32_t rc = pcre2_serialize_encode(&code, 1, bytes, &serialized_size, NULL);
+
+    if (rc < 0)
+        return rc;
+
+    if (serialized_size > UINT32_MAX)
+    {
+        pcre2_serialize_free(*bytes);
+        *bytes = NULL;
+        return PCRE2_ERROR_NOMEMORY;
+    }
+
+    *size = (uint32_t)serialized_size;
+    return 0;
+}
+
+PCRENET_EXPORT(void, serialize_code_free)(uint8_t* bytes)
+{
+    pcre2_serialize_free(bytes);
+}
+
 PCRENET_EXPORT(void, code_free)(pcre2_code* code)
 {
     if (code)
+    {
+        unregister_jit_code(code);
         pcre2_code_free(code);
+    }
 }
@@ -0,0 +1,129 @@
+#include "pcrenet.h"
+
+#if defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   include <time.h>
+#endif
+
+#if defined(_MSC_VER)
+#   define PCRENET_THREAD_LOCAL __declspec(thread)
+#else
+#   define PCRENET_THREAD_LOCAL __thread
+#endif
+
+// Deadlines are checked when the match limit is reached: the limit given to PCRE2 is lowered to a few steps,
+// and the patched matchers call pcrenet_match_limit_reached instead of failing right away (see the patches directory).
+// The deadline is checked there, and the matcher is granted more steps until the actual match limit is reached.
+// This keeps the cost of a deadline to a clock read every few thousand steps, for both the interpreter and the JIT.
+
+static PCRENET_THREAD_LOCAL match_deadline* current_deadline;
+
+uint64_t pcrenet_get_timestamp(void)
+{
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency;
+
+    if (!frequency.QuadPart)
+        QueryPerformanceFrequency(&frequency);
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+
+    const uint64_t ticks = (uint64_t)counter.QuadPart;
+    const uint64_t ticks_per_second = (uint64_t)frequency.QuadPart;
+
+    return ticks / ticks_per_second * 1000000000u + ticks % ticks_per_second * 1000000000u / ticks_per_second;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#endif
+}
+
+int pcrenet_deadline_init(match_deadline* deadline, const match_settings* settings)
+{
+    deadline->deadline = settings->timeout ? pcrenet_get_timestamp() + settings->timeout : 0;
+    deadline->cancellation_flag = settings->cancellation_flag;
+
+    return deadline->deadline || deadline->cancellation_flag;
+}
+
+uint32_t pcrenet_deadline_enter(match_deadline* deadline, const void* owner, const uint32_t match_limit, const uint32_t check_interval)
+{
+    deadline->owner = owner;
+    deadline->start = NULL;
+    deadline->match_limit = match_limit;
+    deadline->check_interval = check_interval;
+    deadline->initial_steps = match_limit < check_interval ? match_limit : check_interval;
+    deadline->granted_steps = deadline->initial_steps;
+
+    // Matches can be nested through callouts, so the enclosing deadline is restored when leaving.
+    deadline->previous = current_deadline;
+    current_deadline = deadline;
+
+    return deadline->initial_steps;
+}
+
+void pcrenet_deadline_leave(const match_deadline* deadline)
+{
+    current_deadline = deadline->previous;
+}
+
+int pcrenet_deadline_check(const match_deadline* deadline)
+{
+    if (deadline->cancellation_flag && *deadline->cancellation_flag)
+        return PCRENET_ERROR_CANCELLED;
+
+    if (deadline->deadline && pcrenet_get_timestamp() >= deadline->deadline)
+        return PCRENET_ERROR_TIMEOUT;
+
+    return 0;
+}
+
+int pcrenet_match_limit_reached(const void* callout_data, const void* start)
+{
+    match_deadline* deadline = current_deadline;
+
+    // A nested match without a deadline has different callout data, and gets the usual error.
+    if (!deadline || deadline->owner != callout_data)
+        return PCRE2_ERROR_MATCHLIMIT;
+
+    // The interpreter and the JIT apply the match limit to each start position, and start again with
+    // the initial steps at each one. The DFA matcher applies it to the whole call, and passes no start.
+    if (start != deadline->start)
+    {
+        deadline->start = start;
+        deadline->granted_steps = deadline->initial_steps;
+    }
+
+    if (deadline->granted_steps >= deadline->match_limit)
+        return PCRE2_ERROR_MATCHLIMIT;
+
+    const int result = pcrenet_deadline_check(deadline);
+    if (result)
+        return result;
+
+    const uint32_t remaining_steps = deadline->match_limit - deadline->granted_steps;
+    const uint32_t steps = remaining_steps < deadline->check_interval ? remaining_steps : deadline->check_interval;
+
+    deadline->granted_steps += steps;
+    return (int)steps;
+}
+
+const char* pcrenet_deadline_error_message(const int32_t error_code)
+{
+    switch (error_code)
+    {
+    case PCRENET_ERROR_TIMEOUT:
+        return "match timeout elapsed";
+
+    case PCRENET_ERROR_CANCELLED:
+        return "match cancelled";
+
+    default:
+        return NULL;
+    }
+}
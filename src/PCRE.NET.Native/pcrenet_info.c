@@ -3,7 +3,30 @@
 
 PCRENET_EXPORT(int32_t, get_error_message)(const int32_t error_code, PCRE2_UCHAR* error_buffer, const uint32_t buffer_size)
 {
-    return pcre2_get_error_message(error_code, error_buffer, buffer_size);
+    const char* message = pcrenet_deadline_error_message(error_code);
+    if (!message)
+        return pcre2_get_error_message(error_code, error_buffer, buffer_size);
+
+    // Same behavior as pcre2_get_error_message for the error codes defined by PCRE.NET
+
+    if (buffer_size == 0)
+        return PCRE2_ERROR_NOMEMORY;
+
+    uint32_t length = 0;
+
+    for (; message[length]; ++length)
+    {
+        if (length == buffer_size - 1)
+        {
+            error_buffer[length] = 0;
+            return PCRE2_ERROR_NOMEMORY;
+        }
+
+        error_buffer[length] = (PCRE2_UCHAR)message[length];
+    }
+
+    error_buffer[length] = 0;
+    return (int32_t)length;
 }
 
 PCRENET_EXPORT(int32_t, pattern_info)(const pcre2_code* code, const uint32_t key, void* data)
@@ -54,3 +77,38 @@ PCRENET_EXPORT(void, jit_stack_free)(pcre2_jit_stack* stack)
 {
     pcre2_jit_stack_free(stack);
 }
+
+PCRENET_EXPORT(void, jit_memory_get_stats)(pcrenet_jit_memory_stats* stats)
+{
+    pcrenet_jit_memory_get_stats(stats);
+}
+
+PCRENET_EXPORT(void, jit_memory_set_huge_pages)(const int32_t enabled)
+{
+    pcrenet_jit_memory_set_huge_pages(enabled);
+}
+
+PCRENET_EXPORT(int32_t, jit_memory_enable_custom_allocator)(void)
+{
+    return pcrenet_jit_memory_enable_custom_allocator();
+}
+
+PCRENET_EXPORT(void, jit_memory_trim)(void)
+{
+    pcrenet_jit_memory_trim();
+}
+
+PCRENET_EXPORT(uint32_t, jit_profiling_get_supported_flags)(void)
+{
+    return pcrenet_jit_profiling_get_supported_flags();
+}
+
+PCRENET_EXPORT(uint32_t, jit_profiling_get_flags)(void)
+{
+    return pcrenet_jit_profiling_get_flags();
+}
+
+PCRENET_EXPORT(void, jit_profiling_set_flags)(const uint32_t flags)
+{
+    pcrenet_jit_profiling_set_flags(flags);
+}
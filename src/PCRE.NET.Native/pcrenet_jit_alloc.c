@@ -0,0 +1,433 @@
+#include "pcrenet.h"
+
+#if PCRENET_JIT_ALLOCATOR
+
+#include <pthread.h>
+#include <sys/mman.h>
+
+// Executable memory allocator for the JIT compiler, which can replace the sljit one.
+//
+// The sljit allocator stays the default. This one is used when it's enabled before the first JIT allocation,
+// as the choice can't change afterwards: blocks must be freed by the allocator which returned them.
+//
+// Memory is reserved in regions of REGION_SIZE bytes, aligned on their size so the region of a block can be found from its address.
+// Each region belongs to an arena, with its own lock and free list. Threads are assigned an arena on their first allocation,
+// so concurrent compilations don't contend on a single lock, while a block can still be freed from any thread.
+// Allocations which don't fit in a region get a dedicated mapping.
+//
+// The region size matches the size of a huge page, so regions can be backed by transparent huge pages to reduce iTLB misses.
+
+#define REGION_SIZE ((size_t)2 << 20)
+#define ARENA_COUNT 8
+#define BLOCK_ALIGNMENT 16
+#define MIN_BLOCK_SIZE 64
+
+#define BLOCK_USED ((size_t)1)
+#define BLOCK_SIZE(header) ((header)->size & ~BLOCK_USED)
+#define IS_BLOCK_USED(header) (((header)->size & BLOCK_USED) != 0)
+
+#define ALIGN_UP(value, alignment) (((value) + (alignment) - 1) & ~((size_t)(alignment) - 1))
+
+typedef struct arena arena;
+
+typedef struct
+{
+    arena* owner; // NULL for dedicated mappings
+    size_t size;
+} region_header;
+
+// Blocks use boundary tags: each block header holds its size and the size of the previous block (0 for the first one).
+// A region ends with a zero-sized block header.
+typedef struct
+{
+    size_t size;
+    size_t prev_size;
+} block_header;
+
+typedef struct free_block
+{
+    block_header header;
+    struct free_block* next;
+    struct free_block* prev;
+} free_block;
+
+struct arena
+{
+    pthread_mutex_t lock;
+    free_block* free_blocks;
+    region_header* spare_region;
+};
+
+#define REGION_HEADER_SIZE ALIGN_UP(sizeof(region_header), BLOCK_ALIGNMENT)
+#define FIRST_BLOCK(region) ((block_header*)((uint8_t*)(region) + REGION_HEADER_SIZE))
+#define REGION_BLOCK_SIZE (REGION_SIZE - REGION_HEADER_SIZE - sizeof(block_header))
+#define NEXT_BLOCK(header) ((block_header*)((uint8_t*)(header) + BLOCK_SIZE(header)))
+#define PREV_BLOCK(header) ((block_header*)((uint8_t*)(header) - (header)->prev_size))
+#define REGION_OF(header) ((region_header*)((uintptr_t)(header) & ~(uintptr_t)(REGION_SIZE - 1)))
+
+c_static_assert(sizeof(block_header) % BLOCK_ALIGNMENT == 0, "Block headers must preserve the alignment");
+c_static_assert(sizeof(free_block) <= MIN_BLOCK_SIZE, "Free blocks must fit in the minimum block size");
+
+static arena arenas[ARENA_COUNT] = {
+    { PTHREAD_MUTEX_INITIALIZER, NULL, NULL }, { PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+    { PTHREAD_MUTEX_INITIALIZER, NULL, NULL }, { PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+    { PTHREAD_MUTEX_INITIALIZER, NULL, NULL }, { PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+    { PTHREAD_MUTEX_INITIALIZER, NULL, NULL }, { PTHREAD_MUTEX_INITIALIZER, NULL, NULL }
+};
+
+static __thread arena* thread_arena;
+static uint32_t next_arena_index;
+static int use_huge_pages;
+
+#define SELECTION_ARENAS 0x01 // This allocator is requested
+#define SELECTION_LOCKED 0x02 // A JIT allocation has been made, the selection can't change anymore
+
+static int allocator_selection;
+
+static uint64_t stat_reserved_size;
+static uint64_t stat_allocated_size;
+static uint64_t stat_allocation_count;
+static uint64_t stat_region_count;
+
+#define STAT_ADD(stat, value) __atomic_add_fetch(&(stat), (uint64_t)(value), __ATOMIC_RELAXED)
+#define STAT_SUB(stat, value) __atomic_sub_fetch(&(stat), (uint64_t)(value), __ATOMIC_RELAXED)
+#define STAT_GET(stat) __atomic_load_n(&(stat), __ATOMIC_RELAXED)
+
+static region_header* map_region(const size_t size, arena* owner)
+{
+    // Over-allocate to align the region on REGION_SIZE, then give back the unused parts
+
+    const size_t mapping_size = size + REGION_SIZE;
+    uint8_t* mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mapping == MAP_FAILED)
+        return NULL;
+
+    uint8_t* start = (uint8_t*)ALIGN_UP((uintptr_t)mapping, REGION_SIZE);
+    uint8_t* end = start + size;
+
+    if (start != mapping)
+        munmap(mapping, (size_t)(start - mapping));
+
+    if (end != mapping + mapping_size)
+        munmap(end, (size_t)(mapping + mapping_size - end));
+
+#ifdef MADV_HUGEPAGE
+    if (__atomic_load_n(&use_huge_pages, __ATOMIC_RELAXED))
+        madvise(start, size, MADV_HUGEPAGE);
+#endif
+
+    region_header* region = (region_header*)start;
+    region->owner = owner;
+    region->size = size;
+
+    STAT_ADD(stat_reserved_size, size);
+    STAT_ADD(stat_region_count, 1);
+    return region;
+}
+
+static void unmap_region(region_header* region)
+{
+    STAT_SUB(stat_reserved_size, region->size);
+    STAT_SUB(stat_region_count, 1);
+    munmap(region, region->size);
+}
+
+static arena* get_thread_arena(void)
+{
+    if (!thread_arena)
+        thread_arena = &arenas[__atomic_fetch_add(&next_arena_index, 1, __ATOMIC_RELAXED) % ARENA_COUNT];
+
+    return thread_arena;
+}
+
+static void insert_free_block(arena* owner, free_block* block)
+{
+    block->prev = NULL;
+    block->next = owner->free_blocks;
+
+    if (owner->free_blocks)
+        owner->free_blocks->prev = block;
+
+    owner->free_blocks = block;
+}
+
+static void remove_free_block(arena* owner, const free_block* block)
+{
+    if (block->next)
+        block->next->prev = block->prev;
+
+    if (block->prev)
+        block->prev->next = block->next;
+    else
+        owner->free_blocks = block->next;
+}
+
+static free_block* init_region(arena* owner, region_header* region)
+{
+    free_block* block = (free_block*)FIRST_BLOCK(region);
+    block->header.size = REGION_BLOCK_SIZE;
+    block->header.prev_size = 0;
+
+    block_header* terminator = NEXT_BLOCK(&block->header);
+    terminator->size = BLOCK_USED;
+    terminator->prev_size = REGION_BLOCK_SIZE;
+
+    insert_free_block(owner, block);
+    return block;
+}
+
+static void* alloc_dedicated(const size_t block_size)
+{
+    region_header* region = map_region(ALIGN_UP(REGION_HEADER_SIZE + block_size, REGION_SIZE), NULL);
+    if (!region)
+        return NULL;
+
+    block_header* header = FIRST_BLOCK(region);
+    header->size = block_size | BLOCK_USED;
+    header->prev_size = 0;
+
+    STAT_ADD(stat_allocated_size, block_size);
+    STAT_ADD(stat_allocation_count, 1);
+    return header + 1;
+}
+
+void* pcrenet_jit_alloc(const size_t size)
+{
+    size_t block_size = ALIGN_UP(size + sizeof(block_header), BLOCK_ALIGNMENT);
+    if (block_size < MIN_BLOCK_SIZE)
+        block_size = MIN_BLOCK_SIZE;
+
+    if (block_size > REGION_BLOCK_SIZE)
+        return alloc_dedicated(block_size);
+
+    arena* owner = get_thread_arena();
+    pthread_mutex_lock(&owner->lock);
+
+    free_block* block = owner->free_blocks;
+    while (block && block->header.size < block_size)
+        block = block->next;
+
+    if (!block)
+    {
+        region_header* region = owner->spare_region;
+        owner->spare_region = NULL;
+
+        if (!region)
+            region = map_region(REGION_SIZE, owner);
+
+        if (!region)
+        {
+            pthread_mutex_unlock(&owner->lock);
+            return NULL;
+        }
+
+        block = init_region(owner, region);
+    }
+
+    block_header* header = &block->header;
+    const size_t available = header->size;
+
+    if (available - block_size >= MIN_BLOCK_SIZE)
+    {
+        // Use the end of the free block, which stays in the list
+        header->size = available - block_size;
+
+        block_header* used = NEXT_BLOCK(header);
+        used->size = block_size;
+        used->prev_size = header->size;
+        NEXT_BLOCK(used)->prev_size = block_size;
+
+        header = used;
+    }
+    else
+    {
+        remove_free_block(owner, block);
+        block_size = available;
+    }
+
+    header->size = block_size | BLOCK_USED;
+    pthread_mutex_unlock(&owner->lock);
+
+    STAT_ADD(stat_allocated_size, block_size);
+    STAT_ADD(stat_allocation_count, 1);
+    return header + 1;
+}
+
+void pcrenet_jit_free(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    block_header* header = (block_header*)ptr - 1;
+    region_header* region = REGION_OF(header);
+    size_t block_size = BLOCK_SIZE(header);
+
+    STAT_SUB(stat_allocated_size, block_size);
+    STAT_SUB(stat_allocation_count, 1);
+
+    arena* owner = region->owner;
+
+    if (!owner)
+    {
+        unmap_region(region);
+        return;
+    }
+
+    pthread_mutex_lock(&owner->lock);
+
+    header->size = block_size;
+
+    // Merge with the following and preceding free blocks
+
+    block_header* next = NEXT_BLOCK(header);
+    if (!IS_BLOCK_USED(next))
+    {
+        remove_free_block(owner, (free_block*)next);
+        block_size += next->size;
+        header->size = block_size;
+    }
+
+    if (header->prev_size != 0)
+    {
+        block_header* prev = PREV_BLOCK(header);
+
+        if (!IS_BLOCK_USED(prev))
+        {
+            remove_free_block(owner, (free_block*)prev);
+            block_size += prev->size;
+            prev->size = block_size;
+            header = prev;
+        }
+    }
+
+    NEXT_BLOCK(header)->prev_size = block_size;
+
+    if (block_size == REGION_BLOCK_SIZE)
+    {
+        // The region is empty: keep one per arena to avoid mapping churn
+        if (!owner->spare_region)
+            owner->spare_region = region;
+        else
+            unmap_region(region);
+    }
+    else
+    {
+        insert_free_block(owner, (free_block*)header);
+    }
+
+    pthread_mutex_unlock(&owner->lock);
+}
+
+int pcrenet_jit_use_arenas(void)
+{
+    int selection = __atomic_load_n(&allocator_selection, __ATOMIC_ACQUIRE);
+
+    if (!(selection & SELECTION_LOCKED))
+        selection = __atomic_or_fetch(&allocator_selection, SELECTION_LOCKED, __ATOMIC_ACQ_REL);
+
+    return selection & SELECTION_ARENAS;
+}
+
+static int is_using_arenas(void)
+{
+    return (__atomic_load_n(&allocator_selection, __ATOMIC_ACQUIRE) & SELECTION_ARENAS) != 0;
+}
+
+static int enable_arenas(void)
+{
+    int selection = 0;
+
+    if (__atomic_compare_exchange_n(&allocator_selection, &selection, SELECTION_ARENAS, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        return 1;
+
+    return (selection & SELECTION_ARENAS) != 0;
+}
+
+static void get_arena_stats(pcrenet_jit_memory_stats* stats)
+{
+    stats->reserved_size = STAT_GET(stat_reserved_size);
+    stats->allocated_size = STAT_GET(stat_allocated_size);
+    stats->allocation_count = STAT_GET(stat_allocation_count);
+    stats->region_count = STAT_GET(stat_region_count);
+    stats->flags = PCRENET_JIT_MEMORY_CUSTOM_ALLOCATOR;
+
+    if (__atomic_load_n(&use_huge_pages, __ATOMIC_RELAXED))
+        stats->flags |= PCRENET_JIT_MEMORY_HUGE_PAGES;
+}
+
+static void trim_arenas(void)
+{
+    for (int i = 0; i < ARENA_COUNT; ++i)
+    {
+        arena* owner = &arenas[i];
+
+        pthread_mutex_lock(&owner->lock);
+        region_header* region = owner->spare_region;
+        owner->spare_region = NULL;
+        pthread_mutex_unlock(&owner->lock);
+
+        if (region)
+            unmap_region(region);
+    }
+}
+
+#endif
+
+// The builtin sljit allocator has a separate instance for each code unit width
+
+static void get_builtin_stats(pcrenet_jit_memory_stats* stats)
+{
+    pcrenet_jit_memory_stats stats_16;
+
+    jit_builtin_memory_stats_8(stats);
+    jit_builtin_memory_stats_16(&stats_16);
+
+    stats->reserved_size += stats_16.reserved_size;
+    stats->allocated_size += stats_16.allocated_size;
+}
+
+static void trim_builtin(void)
+{
+    pcre2_jit_free_unused_memory_8(NULL);
+    pcre2_jit_free_unused_memory_16(NULL);
+}
+
+void pcrenet_jit_memory_get_stats(pcrenet_jit_memory_stats* stats)
+{
+#if PCRENET_JIT_ALLOCATOR
+    if (is_using_arenas())
+    {
+        get_arena_stats(stats);
+        return;
+    }
+#endif
+
+    get_builtin_stats(stats);
+}
+
+// ReSharper disable once CppParameterNeverUsed
+void pcrenet_jit_memory_set_huge_pages(const int enabled)
+{
+#if PCRENET_JIT_ALLOCATOR
+    __atomic_store_n(&use_huge_pages, enabled, __ATOMIC_RELAXED);
+#endif
+}
+
+int pcrenet_jit_memory_enable_custom_allocator(void)
+{
+#if PCRENET_JIT_ALLOCATOR
+    return enable_arenas();
+#else
+    return 0;
+#endif
+}
+
+void pcrenet_jit_memory_trim(void)
+{
+#if PCRENET_JIT_ALLOCATOR
+    trim_arenas();
+#endif
+
+    trim_builtin();
+}
@@ -0,0 +1,230 @@
+// This file is included at the end of pcre2_jit_compile.c, in order to use the internals of the JIT compiler.
+// The JIT compiler is compiled separately for each code unit width.
+
+#ifdef SUPPORT_JIT
+
+#include "pcrenet_bitmap.h"
+
+// Greedy and possessive iterators over simple classes match one code unit per loop iteration in the JIT.
+// The local patch of compile_iterator_matchingpath (patches/pcre2_jit_class_span.patch) calls pcrenet_emit_class_span before these loops,
+// which skips the longest run of code units that are characters of the class on their own with a vectorized scan.
+// The loop then matches the remaining characters and handles the end of the run as usual.
+// The start of the match is searched the same way when the pattern has a start bitmap (patches/pcre2_jit_start_bits.patch).
+
+// The first code units of a run are matched inline, and the scan is only called for longer runs, which pay for the call.
+#define CLASS_SPAN_MIN_LENGTH 32
+
+typedef struct
+{
+    uint8_t stop_bitmap[32]; // The code units which end a run
+    uint8_t low_table[16];
+    uint8_t high_table[16];
+} class_span_data;
+
+static PCRE2_SPTR SLJIT_FUNC class_span(const class_span_data* data, PCRE2_SPTR ptr, PCRE2_SPTR end)
+{
+#if PCRENET_SSE2
+    if (pcrenet_has_ssse3())
+        ptr = find_in_bitmap_ssse3(ptr, end, data->low_table, data->high_table);
+#elif PCRENET_NEON
+    ptr = find_in_bitmap_neon(ptr, end, data->low_table, data->high_table);
+#endif
+
+    while (ptr < end && !IN_BITMAP(data->stop_bitmap, *ptr))
+        ++ptr;
+
+    return ptr;
+}
+
+static void exclude_from_class_span(uint8_t* bitmap, const uint32_t c)
+{
+#if PCRE2_CODE_UNIT_WIDTH == 8
+    // Characters above 255 only use bytes above 127, which are never skipped in UTF-8
+    if (c > 255)
+        return;
+#endif
+
+    // Bit 255 stands for all the code units above 255 in the 16-bit library
+    const uint32_t index = c > 255 ? 255 : c;
+    bitmap[index / 8] &= (uint8_t)~(1u << (index & 7));
+}
+
+// Fills the bitmap of the code units which match a character of the iterated class on their own.
+// Returns FALSE if the iterated character type is not a simple class.
+static BOOL get_class_span_bitmap(compiler_common* common, const PCRE2_UCHAR type, PCRE2_SPTR cc, uint8_t* bitmap)
+{
+    const uint8_t* ctypes = (const uint8_t*)common->ctypes;
+    uint32_t ctype, c;
+    BOOL negated;
+
+    switch (type)
+    {
+    case OP_CLASS:
+        memcpy(bitmap, cc, 32);
+        exclude_from_class_span(bitmap, 256); // Characters above 255 are not in the class
+        break;
+
+    case OP_NCLASS:
+        memcpy(bitmap, cc, 32);
+        break;
+
+    case OP_NOT:
+    case OP_NOTI:
+        memset(bitmap, 0xff, 32);
+#ifdef SUPPORT_UNICODE
+        if (common->utf)
+        {
+            GETCHAR(c, cc);
+        }
+        else
+#endif
+            c = *cc;
+
+        exclude_from_class_span(bitmap, c);
+        if (type == OP_NOTI && char_has_othercase(common, cc))
+            exclude_from_class_span(bitmap, char_othercase(common, c));
+        break;
+
+    case OP_DIGIT:
+    case OP_NOT_DIGIT:
+    case OP_WHITESPACE:
+    case OP_NOT_WHITESPACE:
+    case OP_WORDCHAR:
+    case OP_NOT_WORDCHAR:
+        // Same as read_char8_type: the character types of the tables, and no type above 255
+        ctype = type == OP_DIGIT || type == OP_NOT_DIGIT ? ctype_digit
+            : type == OP_WHITESPACE || type == OP_NOT_WHITESPACE ? ctype_space
+            : ctype_word;
+        negated = type == OP_NOT_DIGIT || type == OP_NOT_WHITESPACE || type == OP_NOT_WORDCHAR;
+
+        memset(bitmap, 0, 32);
+        for (c = 0; c < 256; ++c)
+        {
+            if (((ctypes[c] & ctype) != 0) != negated)
+                bitmap[c / 8] |= (uint8_t)(1u << (c & 7));
+        }
+
+        if (!negated)
+            exclude_from_class_span(bitmap, 256);
+        break;
+
+    default:
+        return FALSE;
+    }
+
+#ifdef SUPPORT_UNICODE
+#if PCRE2_CODE_UNIT_WIDTH == 8
+    // The bytes above 127 are parts of multi-byte characters
+    if (common->utf)
+        memset(bitmap + 16, 0, 16);
+#else
+    // Unpaired surrogates are not characters
+    if (common->invalid_utf)
+        exclude_from_class_span(bitmap, 256);
+#endif
+#endif
+
+    for (c = 0; c < 32; ++c)
+    {
+        if (bitmap[c] != 0)
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+// Emits the scan of STR_PTR up to the first code unit of data->stop_bitmap, or STR_END if there is none.
+// TMP1, TMP2 and TMP3 are overwritten, and the scratch registers are overwritten by the call for long runs.
+static void emit_bitmap_scan(compiler_common* common, const class_span_data* data)
+{
+    DEFINE_COMPILER;
+    struct sljit_jump* too_short;
+    struct sljit_jump* short_run;
+    struct sljit_label* label;
+
+    OP2(SLJIT_SUB, TMP1, 0, STR_END, 0, STR_PTR, 0);
+    too_short = CMP(SLJIT_SIG_LESS_EQUAL, TMP1, 0, SLJIT_IMM, IN_UCHARS(CLASS_SPAN_MIN_LENGTH));
+    OP2(SLJIT_ADD, TMP3, 0, STR_PTR, 0, SLJIT_IMM, IN_UCHARS(CLASS_SPAN_MIN_LENGTH));
+
+    label = LABEL();
+    OP1(MOV_UCHAR, TMP1, 0, SLJIT_MEM1(STR_PTR), 0);
+#if PCRE2_CODE_UNIT_WIDTH != 8
+    OP2U(SLJIT_SUB | SLJIT_SET_GREATER, TMP1, 0, SLJIT_IMM, 255);
+    SELECT(SLJIT_GREATER, TMP1, SLJIT_IMM, 255, TMP1);
+#endif
+    OP2(SLJIT_AND, TMP2, 0, TMP1, 0, SLJIT_IMM, 0x7);
+    OP2(SLJIT_LSHR, TMP1, 0, TMP1, 0, SLJIT_IMM, 3);
+    OP1(SLJIT_MOV_U8, TMP1, 0, SLJIT_MEM1(TMP1), (sljit_sw)data->stop_bitmap);
+    OP2(SLJIT_SHL, TMP2, 0, SLJIT_IMM, 1, TMP2, 0);
+    OP2U(SLJIT_AND | SLJIT_SET_Z, TMP1, 0, TMP2, 0);
+    short_run = JUMP(SLJIT_NOT_ZERO);
+    OP2(SLJIT_ADD, STR_PTR, 0, STR_PTR, 0, SLJIT_IMM, IN_UCHARS(1));
+    CMPTO(SLJIT_LESS, STR_PTR, 0, TMP3, 0, label);
+
+    SLJIT_ASSERT(STR_PTR == SLJIT_R1);
+    OP1(SLJIT_MOV, SLJIT_R0, 0, SLJIT_IMM, (sljit_sw)data);
+    OP1(SLJIT_MOV, SLJIT_R2, 0, STR_END, 0);
+    sljit_emit_icall(compiler, SLJIT_CALL, SLJIT_ARGS3(W, W, W, W), SLJIT_IMM, SLJIT_FUNC_ADDR(class_span));
+    OP1(SLJIT_MOV, STR_PTR, 0, SLJIT_RETURN_REG, 0);
+
+    JUMPHERE(too_short);
+    JUMPHERE(short_run);
+}
+
+// Emits the vectorized scan at the start of a greedy or possessive iterator, when the iterated type is a simple class.
+// The first character is matched beforehand when backtracks is not NULL, so the scan can replace the first iteration of a plus.
+// Returns TRUE if the scan was emitted, in which case TMP1, TMP2 and TMP3 are overwritten.
+static BOOL pcrenet_emit_class_span(compiler_common* common, const PCRE2_UCHAR type, PCRE2_SPTR cc, jump_list** backtracks)
+{
+    uint8_t bitmap[32];
+    class_span_data* data;
+    int i;
+
+    if (common->mode != PCRE2_JIT_COMPLETE || !get_class_span_bitmap(common, type, cc, bitmap))
+        return FALSE;
+
+    data = (class_span_data*)allocate_read_only_data(common, sizeof(class_span_data));
+    if (data == NULL)
+        return FALSE;
+
+    for (i = 0; i < 32; ++i)
+        data->stop_bitmap[i] = (uint8_t)~bitmap[i];
+
+    build_bitmap_tables(data->stop_bitmap, data->low_table, data->high_table);
+
+    if (backtracks != NULL)
+        compile_char1_matchingpath(common, type, cc, backtracks, TRUE);
+
+    emit_bitmap_scan(common, data);
+    return TRUE;
+}
+
+// Emits the vectorized scan for the next code unit of the start bitmap, which the loop of fast_forward_start_bits
+// jumps to when a code unit is not in the start bitmap. The scan is skipped when entering the loop, so the start positions
+// which immediately follow each other don't pay for it, and the loop still checks the code unit which was found.
+// Returns NULL when the end of the subject is limited (first line or offset limit), as the saved end is in a scratch register.
+static struct sljit_label* pcrenet_emit_start_bits_scan(compiler_common* common)
+{
+    DEFINE_COMPILER;
+    class_span_data* data;
+    struct sljit_jump* entry;
+    struct sljit_label* label;
+
+    if (common->match_end_ptr != 0)
+        return NULL;
+
+    data = (class_span_data*)allocate_read_only_data(common, sizeof(class_span_data));
+    if (data == NULL)
+        return NULL;
+
+    memcpy(data->stop_bitmap, common->re->start_bitmap, 32);
+    build_bitmap_tables(data->stop_bitmap, data->low_table, data->high_table);
+
+    entry = JUMP(SLJIT_JUMP);
+    label = LABEL();
+    emit_bitmap_scan(common, data);
+    JUMPHERE(entry);
+    return label;
+}
+
+#endif
@@ -0,0 +1,75 @@
+// This file is included at the end of pcre2_jit_compile.c, in order to access the internal state of the JIT compiler.
+// The JIT compiler and its builtin allocator are compiled separately for each code unit width.
+
+#include "pcrenet.h"
+
+void PCRENET_SUFFIX(jit_builtin_memory_stats)(pcrenet_jit_memory_stats* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+#if defined(SUPPORT_JIT) && SLJIT_EXECUTABLE_ALLOCATOR && !SLJIT_PROT_EXECUTABLE_ALLOCATOR && !SLJIT_WX_EXECUTABLE_ALLOCATOR
+    SLJIT_ALLOCATOR_LOCK();
+    stats->reserved_size = sljit_total_size;
+    stats->allocated_size = sljit_allocated_size;
+    SLJIT_ALLOCATOR_UNLOCK();
+#endif
+}
+
+int PCRENET_SUFFIX(get_jit_code)(const pcre2_code* code, const uint32_t mode_index, void** address, size_t* size)
+{
+#ifdef SUPPORT_JIT
+    const executable_functions* functions = (const executable_functions*)((const pcre2_real_code*)code)->executable_jit;
+
+    if (functions && mode_index < JIT_NUMBER_OF_COMPILE_MODES && functions->executable_funcs[mode_index])
+    {
+        *address = functions->executable_funcs[mode_index];
+        *size = functions->executable_sizes[mode_index];
+        return 1;
+    }
+#endif
+
+    return 0;
+}
+
+#ifdef SUPPORT_JIT
+
+// Called when the match limit is reached, with the return address on the stack. The match deadline is checked,
+// and the match either leaves with an error, or goes on with the steps it was granted as its new match count.
+static void pcrenet_emit_match_limit_check(compiler_common* common)
+{
+    DEFINE_COMPILER;
+    const sljit_s32 save_ptr = common->pcrenet_limit_save_ptr;
+    struct sljit_jump* granted;
+    int i;
+
+    sljit_emit_op_dst(compiler, SLJIT_FAST_ENTER, SLJIT_MEM1(SLJIT_SP), save_ptr);
+
+    // The check may happen anywhere in the match, so all the scratch registers are preserved.
+    for (i = 0; i < 5; ++i)
+        OP1(SLJIT_MOV, SLJIT_MEM1(SLJIT_SP), save_ptr + (i + 1) * SSIZE_OF(sw), SLJIT_R(i), 0);
+
+    if (HAS_VIRTUAL_REGISTERS)
+    {
+        OP1(SLJIT_MOV, SLJIT_R0, 0, ARGUMENTS, 0);
+        OP1(SLJIT_MOV, SLJIT_R0, 0, SLJIT_MEM1(SLJIT_R0), SLJIT_OFFSETOF(jit_arguments, callout_data));
+    }
+    else
+        OP1(SLJIT_MOV, SLJIT_R0, 0, SLJIT_MEM1(ARGUMENTS), SLJIT_OFFSETOF(jit_arguments, callout_data));
+
+    OP1(SLJIT_MOV, SLJIT_R1, 0, SLJIT_MEM1(SLJIT_SP), common->start_ptr);
+    sljit_emit_icall(compiler, SLJIT_CALL, SLJIT_ARGS2(32, W, W), SLJIT_IMM, SLJIT_FUNC_ADDR(pcrenet_match_limit_reached));
+
+    OP1(SLJIT_MOV_S32, SLJIT_RETURN_REG, 0, SLJIT_RETURN_REG, 0);
+    granted = CMP(SLJIT_SIG_GREATER, SLJIT_RETURN_REG, 0, SLJIT_IMM, 0);
+    JUMPTO(SLJIT_JUMP, common->quit_label);
+
+    JUMPHERE(granted);
+    OP1(SLJIT_MOV, COUNT_MATCH, 0, SLJIT_RETURN_REG, 0);
+
+    for (i = 0; i < 5; ++i)
+        OP1(SLJIT_MOV, SLJIT_R(i), 0, SLJIT_MEM1(SLJIT_SP), save_ptr + (i + 1) * SSIZE_OF(sw));
+
+    OP_SRC(SLJIT_FAST_RETURN, SLJIT_MEM1(SLJIT_SP), save_ptr);
+}
+
+#endif
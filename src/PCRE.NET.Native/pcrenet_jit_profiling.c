@@ -0,0 +1,346 @@
+#include "pcrenet.h"
+
+#if defined(__linux__)
+#   define PCRENET_JIT_PROFILING 1
+#endif
+
+#if PCRENET_JIT_PROFILING
+
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Makes JIT-compiled patterns visible to profilers and debuggers:
+//
+// - perf reads symbols for anonymous executable memory from /tmp/perf-<pid>.map.
+//   This file is append-only: entries can't be removed when the code is freed, but a new entry is written
+//   if the same address range gets reused by another pattern.
+//
+// - GDB reads in-memory object files registered through its JIT interface. Each block of JIT code is described
+//   by a minimal ELF file which contains a single symbol, and is unregistered when the code is freed.
+
+static uint32_t profiling_flags;
+static pthread_mutex_t profiling_lock = PTHREAD_MUTEX_INITIALIZER;
+static int perf_map_fd = -1;
+
+// GDB JIT interface, the names and layout are defined by GDB
+
+typedef enum
+{
+    JIT_NOACTION = 0,
+    JIT_REGISTER_FN,
+    JIT_UNREGISTER_FN
+} jit_actions_t;
+
+struct jit_code_entry
+{
+    struct jit_code_entry* next_entry;
+    struct jit_code_entry* prev_entry;
+    const char* symfile_addr;
+    uint64_t symfile_size;
+};
+
+struct jit_descriptor
+{
+    uint32_t version;
+    uint32_t action_flag;
+    struct jit_code_entry* relevant_entry;
+    struct jit_code_entry* first_entry;
+};
+
+// Protected visibility makes sure these are not interposed by the symbols of another JIT compiler in the process
+
+__attribute__((visibility("protected"), noinline)) void __jit_debug_register_code(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+
+__attribute__((visibility("protected"))) struct jit_descriptor __jit_debug_descriptor = { 1, JIT_NOACTION, NULL, NULL };
+
+#if defined(__x86_64__)
+#   define ELF_MACHINE EM_X86_64
+#elif defined(__i386__)
+#   define ELF_MACHINE EM_386
+#elif defined(__aarch64__)
+#   define ELF_MACHINE EM_AARCH64
+#elif defined(__arm__)
+#   define ELF_MACHINE EM_ARM
+#endif
+
+#ifdef ELF_MACHINE
+
+#if __SIZEOF_POINTER__ == 8
+#   define ELF_CLASS ELFCLASS64
+#   define ELF_ST_INFO ELF64_ST_INFO
+#else
+#   define ELF_CLASS ELFCLASS32
+#   define ELF_ST_INFO ELF32_ST_INFO
+#endif
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#   define ELF_DATA ELFDATA2LSB
+#else
+#   define ELF_DATA ELFDATA2MSB
+#endif
+
+enum
+{
+    SECTION_NULL,
+    SECTION_TEXT,
+    SECTION_SYMTAB,
+    SECTION_STRTAB,
+    SECTION_SHSTRTAB,
+    SECTION_COUNT
+};
+
+static const char section_names[] = "\0.text\0.symtab\0.strtab\0.shstrtab";
+
+typedef struct
+{
+    ElfW(Ehdr) header;
+    ElfW(Shdr) sections[SECTION_COUNT];
+    ElfW(Sym) symbols[2];
+    char section_names[sizeof(section_names)];
+    char symbol_names[]; // Starts with a null char
+} elf_image;
+
+typedef struct
+{
+    struct jit_code_entry entry;
+    const void* address;
+    elf_image image;
+} gdb_registration;
+
+static gdb_registration* create_gdb_registration(const void* address, const size_t size, const char* name)
+{
+    const size_t name_size = strlen(name) + 1;
+    const size_t image_size = sizeof(elf_image) + 1 + name_size;
+
+    gdb_registration* registration = calloc(1, offsetof(gdb_registration, image) + image_size);
+    if (!registration)
+        return NULL;
+
+    registration->address = address;
+    registration->entry.symfile_addr = (const char*)&registration->image;
+    registration->entry.symfile_size = image_size;
+
+    // The image describes a relocatable object whose .text section is the JIT code,
+    // GDB uses the section address as-is since the object is not relocated.
+
+    elf_image* image = &registration->image;
+
+    memcpy(image->header.e_ident, ELFMAG, SELFMAG);
+    image->header.e_ident[EI_CLASS] = ELF_CLASS;
+    image->header.e_ident[EI_DATA] = ELF_DATA;
+    image->header.e_ident[EI_VERSION] = EV_CURRENT;
+    image->header.e_ident[EI_OSABI] = ELFOSABI_NONE;
+    image->header.e_type = ET_REL;
+    image->header.e_machine = ELF_MACHINE;
+    image->header.e_version = EV_CURRENT;
+    image->header.e_shoff = offsetof(elf_image, sections);
+    image->header.e_ehsize = sizeof(image->header);
+    image->header.e_shentsize = sizeof(ElfW(Shdr));
+    image->header.e_shnum = SECTION_COUNT;
+    image->header.e_shstrndx = SECTION_SHSTRTAB;
+
+    ElfW(Shdr)* section = &image->sections[SECTION_TEXT];
+    section->sh_name = 1;
+    section->sh_type = SHT_NOBITS;
+    section->sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+    section->sh_addr = (uintptr_t)address;
+    section->sh_size = size;
+    section->sh_addralign = 1;
+
+    section = &image->sections[SECTION_SYMTAB];
+    section->sh_name = 7;
+    section->sh_type = SHT_SYMTAB;
+    section->sh_offset = offsetof(elf_image, symbols);
+    section->sh_size = sizeof(image->symbols);
+    section->sh_link = SECTION_STRTAB;
+    section->sh_info = 1; // Index of the first global symbol
+    section->sh_addralign = sizeof(void*);
+    section->sh_entsize = sizeof(ElfW(Sym));
+
+    section = &image->sections[SECTION_STRTAB];
+    section->sh_name = 15;
+    section->sh_type = SHT_STRTAB;
+    section->sh_offset = offsetof(elf_image, symbol_names);
+    section->sh_size = 1 + name_size;
+    section->sh_addralign = 1;
+
+    section = &image->sections[SECTION_SHSTRTAB];
+    section->sh_name = 23;
+    section->sh_type = SHT_STRTAB;
+    section->sh_offset = offsetof(elf_image, section_names);
+    section->sh_size = sizeof(section_names);
+    section->sh_addralign = 1;
+
+    ElfW(Sym)* symbol = &image->symbols[1];
+    symbol->st_name = 1;
+    symbol->st_info = ELF_ST_INFO(STB_GLOBAL, STT_FUNC);
+    symbol->st_shndx = SECTION_TEXT;
+    symbol->st_value = 0;
+    symbol->st_size = size;
+
+    memcpy(image->section_names, section_names, sizeof(section_names));
+    memcpy(image->symbol_names + 1, name, name_size);
+
+    return registration;
+}
+
+static void gdb_register(const void* address, const size_t size, const char* name)
+{
+    gdb_registration* registration = create_gdb_registration(address, size, name);
+    if (!registration)
+        return;
+
+    struct jit_code_entry* entry = &registration->entry;
+    entry->next_entry = __jit_debug_descriptor.first_entry;
+
+    if (entry->next_entry)
+        entry->next_entry->prev_entry = entry;
+
+    __jit_debug_descriptor.first_entry = entry;
+    __jit_debug_descriptor.relevant_entry = entry;
+    __jit_debug_descriptor.action_flag = JIT_REGISTER_FN;
+    __jit_debug_register_code();
+}
+
+static void gdb_unregister(const void* address)
+{
+    for (struct jit_code_entry* entry = __jit_debug_descriptor.first_entry; entry; entry = entry->next_entry)
+    {
+        gdb_registration* registration = (gdb_registration*)entry;
+        if (registration->address != address)
+            continue;
+
+        if (entry->prev_entry)
+            entry->prev_entry->next_entry = entry->next_entry;
+        else
+            __jit_debug_descriptor.first_entry = entry->next_entry;
+
+        if (entry->next_entry)
+            entry->next_entry->prev_entry = entry->prev_entry;
+
+        __jit_debug_descriptor.relevant_entry = entry;
+        __jit_debug_descriptor.action_flag = JIT_UNREGISTER_FN;
+        __jit_debug_register_code();
+
+        free(registration);
+        return;
+    }
+}
+
+#define GDB_SUPPORTED_FLAG PCRENET_JIT_PROFILING_GDB
+
+#else
+
+// ReSharper disable CppParameterNeverUsed
+static void gdb_register(const void* address, const size_t size, const char* name)
+{
+}
+
+static void gdb_unregister(const void* address)
+{
+}
+// ReSharper restore CppParameterNeverUsed
+
+#define GDB_SUPPORTED_FLAG 0
+
+#endif
+
+static void perf_map_write(const void* address, const size_t size, const char* name)
+{
+    if (perf_map_fd < 0)
+    {
+        char path[64];
+        snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+        perf_map_fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+        if (perf_map_fd < 0)
+            return;
+    }
+
+    // Write each line at once, as the runtime may also write to this file
+    char line[512];
+    const int length = snprintf(line, sizeof(line), "%lx %lx %s\n", (unsigned long)(uintptr_t)address, (unsigned long)size, name);
+
+    if (length > 0 && (size_t)length < sizeof(line))
+        (void)!write(perf_map_fd, line, (size_t)length);
+}
+
+uint32_t pcrenet_jit_profiling_get_supported_flags(void)
+{
+    return PCRENET_JIT_PROFILING_PERF_MAP | GDB_SUPPORTED_FLAG;
+}
+
+uint32_t pcrenet_jit_profiling_get_flags(void)
+{
+    return __atomic_load_n(&profiling_flags, __ATOMIC_RELAXED);
+}
+
+void pcrenet_jit_profiling_set_flags(const uint32_t flags)
+{
+    __atomic_store_n(&profiling_flags, flags & pcrenet_jit_profiling_get_supported_flags(), __ATOMIC_RELAXED);
+}
+
+void pcrenet_jit_profiling_register(const void* address, const size_t size, const char* name)
+{
+    const uint32_t flags = pcrenet_jit_profiling_get_flags();
+    if (!flags)
+        return;
+
+    pthread_mutex_lock(&profiling_lock);
+
+    if (flags & PCRENET_JIT_PROFILING_PERF_MAP)
+        perf_map_write(address, size, name);
+
+    if (flags & PCRENET_JIT_PROFILING_GDB)
+        gdb_register(address, size, name);
+
+    pthread_mutex_unlock(&profiling_lock);
+}
+
+void pcrenet_jit_profiling_unregister(const void* address)
+{
+    // Registrations are kept after the profiling is disabled, so they need to be removed regardless of the current flags
+    if (!__atomic_load_n(&__jit_debug_descriptor.first_entry, __ATOMIC_RELAXED))
+        return;
+
+    pthread_mutex_lock(&profiling_lock);
+    gdb_unregister(address);
+    pthread_mutex_unlock(&profiling_lock);
+}
+
+#else
+
+uint32_t pcrenet_jit_profiling_get_supported_flags(void)
+{
+    return 0;
+}
+
+uint32_t pcrenet_jit_profiling_get_flags(void)
+{
+    return 0;
+}
+
+// ReSharper disable CppParameterNeverUsed
+void pcrenet_jit_profiling_set_flags(const uint32_t flags)
+{
+}
+
+void pcrenet_jit_profiling_register(const void* address, const size_t size, const char* name)
+{
+}
+
+void pcrenet_jit_profiling_unregister(const void* address)
+{
+}
+// ReSharper restore CppParameterNeverUsed
+
+#endif
@@ -3,11 +3,43 @@
 
 typedef int (*callout_fn)(pcre2_callout_block*, void*);
 
+#define PROFILE_SAMPLE_INTERVAL 16
+
+typedef struct
+{
+    uint64_t step_count;
+    uint64_t backtrack_count;
+    uint64_t start_position_count;
+    uint64_t skipped_length;
+    uint64_t heap_frames_size;
+} pcrenet_match_stats;
+
+typedef struct
+{
+    uint64_t hit_count;
+    uint64_t sample_count;
+    uint64_t sampled_time; // In nanoseconds
+    uint32_t next_item_length;
+} pcrenet_profile_entry;
+
+typedef struct
+{
+    pcrenet_profile_entry* entries; // Indexed by pattern position
+    uint32_t length;
+    uint32_t countdown;
+    pcrenet_profile_entry* pending_entry;
+    uint64_t pending_timestamp;
+} pcrenet_profile;
+
 typedef struct
 {
     const pcre2_code* code;
     pcre2_match_data* match_data;
     pcre2_match_context* match_context;
+    match_settings settings;
+    pcrenet_match_stats stats;
+    pcrenet_profile profile;
+    uint32_t* callout_filter; // Owned copy
 } match_buffer;
 
 typedef struct
@@ -21,6 +53,9 @@ typedef struct
     size_t* output_vector;
     callout_fn callout;
     void* callout_data;
+    uint32_t ranges_only; // Only output the range of the match and of the output groups
+    uint32_t output_group_count;
+    const uint32_t* output_groups;
 } pcrenet_match_input;
 
 typedef struct
@@ -32,6 +67,7 @@ typedef struct
     uint32_t additional_options;
     callout_fn callout;
     void* callout_data;
+    const volatile int32_t* cancellation_flag;
 } pcrenet_buffer_match_input;
 
 typedef struct
@@ -46,6 +82,7 @@ typedef struct
     void* callout_data;
     uint32_t max_results;
     uint32_t workspace_size;
+    match_settings settings;
 } pcrenet_dfa_match_input;
 
 typedef struct
@@ -58,6 +95,11 @@ typedef struct
 {
     callout_fn callout;
     void* data;
+    pcrenet_match_stats* stats;
+    pcrenet_profile* profile;
+    const uint32_t* filter;
+    PCRE2_SIZE last_start_position;
+    uint32_t auto_callouts;
 } callout_data;
 
 typedef struct
@@ -65,15 +107,172 @@ typedef struct
     // Input
     pcre2_code* code;
     match_settings settings;
+    uint32_t profile_length;
 
     // Output
     size_t* output_vector;
+    pcrenet_match_stats* stats;
+    pcrenet_profile_entry* profile;
 } match_buffer_info;
 
+static int is_auto_callout(const pcre2_callout_block* block)
+{
+    // Automatic callouts are numbered 255 and have no string.
+    // Patterns which contain an explicit callout 255 are never compiled with automatic callouts.
+    return block->callout_number == 255 && !block->callout_string;
+}
+
+static void record_stats(callout_data* data, const pcre2_callout_block* block, const int auto_callout)
+{
+    pcrenet_match_stats* stats = data->stats;
+
+    // The interpreter flags the first callout after each bumpalong and after each backtrack.
+    if (block->callout_flags & PCRE2_CALLOUT_STARTMATCH)
+    {
+        ++stats->start_position_count;
+        data->last_start_position = block->start_match;
+    }
+
+    if (block->callout_flags & PCRE2_CALLOUT_BACKTRACK)
+        ++stats->backtrack_count;
+
+    if (auto_callout)
+        ++stats->step_count;
+}
+
+static void record_profile(pcrenet_profile* profile, const pcre2_callout_block* block)
+{
+    if (block->pattern_position >= profile->length)
+        return;
+
+    pcrenet_profile_entry* entry = &profile->entries[block->pattern_position];
+    uint64_t timestamp = 0;
+
+    // Timing every item would cost more than most items take to match, so only the item following
+    // every PROFILE_SAMPLE_INTERVAL-th callout is timed, up to the next callout.
+    if (profile->pending_entry)
+    {
+        timestamp = pcrenet_get_timestamp();
+        profile->pending_entry->sampled_time += timestamp - profile->pending_timestamp;
+        ++profile->pending_entry->sample_count;
+        profile->pending_entry = NULL;
+    }
+
+    ++entry->hit_count;
+    entry->next_item_length = (uint32_t)block->next_item_length;
+
+    if (--profile->countdown == 0)
+    {
+        profile->countdown = PROFILE_SAMPLE_INTERVAL;
+        profile->pending_entry = entry;
+        profile->pending_timestamp = timestamp ? timestamp : pcrenet_get_timestamp();
+    }
+}
+
 static int callout_handler(pcre2_callout_block* block, void* data)
 {
-    const callout_data* typed_data = (callout_data*)data;
-    return typed_data->callout(block, typed_data->data);
+    callout_data* typed_data = (callout_data*)data;
+    const int auto_callout = typed_data->auto_callouts && is_auto_callout(block);
+
+    if (typed_data->stats)
+        record_stats(typed_data, block, auto_callout);
+
+    if (typed_data->profile && auto_callout)
+        record_profile(typed_data->profile, block);
+
+    if (auto_callout)
+        return 0;
+
+    if (typed_data->filter && !PCRENET_SUFFIX(callout_filter_accepts)(typed_data->filter, block))
+        return 0;
+
+    return typed_data->callout
+        ? typed_data->callout(block, typed_data->data)
+        : 0;
+}
+
+static int is_empty_callout_filter(const uint32_t* filter)
+{
+    for (int i = 0; i < PCRENET_CALLOUT_FILTER_HEADER_SIZE; ++i)
+    {
+        if (filter[i])
+            return 0;
+    }
+
+    return 1;
+}
+
+static uint32_t* copy_callout_filter(const uint32_t* filter)
+{
+    const size_t size = (PCRENET_CALLOUT_FILTER_HEADER_SIZE + filter[PCRENET_CALLOUT_FILTER_NUMBERS_SIZE]) * sizeof(uint32_t);
+
+    uint32_t* copy = malloc(size);
+    if (copy)
+        memcpy(copy, filter, size);
+
+    return copy;
+}
+
+int PCRENET_SUFFIX(callout_filter_accepts)(const uint32_t* filter, const pcre2_callout_block* block)
+{
+    if (!filter)
+        return 1;
+
+    if (!block->callout_string)
+        return (filter[block->callout_number >> 5] >> (block->callout_number & 31)) & 1;
+
+    // String callouts are identified by their offset in the pattern, as the same string may appear several times.
+    const uint32_t* string_offsets = filter + PCRENET_CALLOUT_FILTER_HEADER_SIZE;
+    uint32_t low = 0;
+    uint32_t high = filter[PCRENET_CALLOUT_FILTER_NUMBERS_SIZE];
+
+    while (low < high)
+    {
+        const uint32_t mid = low + (high - low) / 2;
+        const PCRE2_SIZE offset = string_offsets[mid];
+
+        if (offset == block->callout_string_offset)
+            return 1;
+
+        if (offset < block->callout_string_offset)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return 0;
+}
+
+static void set_callout(pcre2_match_context* context, callout_data* callout, callout_fn fn, void* data, const match_settings* settings, pcrenet_match_stats* stats, pcrenet_profile* profile)
+{
+    // A filter which rejects every callout means the callout function never needs to be called.
+    const int filter_rejects_all = settings->callout_filter && is_empty_callout_filter(settings->callout_filter);
+
+    callout->callout = filter_rejects_all ? NULL : fn;
+    callout->data = data;
+    callout->filter = settings->callout_filter;
+    callout->stats = stats;
+    callout->profile = profile;
+    callout->last_start_position = 0;
+    callout->auto_callouts = settings->auto_callouts;
+
+    // The callout data is set even without a callout, as it identifies the match when its deadline is checked.
+    pcre2_set_callout(context, callout->callout || callout->stats || callout->profile ? &callout_handler : NULL, callout);
+}
+
+void PCRENET_SUFFIX(deadline_enter)(match_deadline* deadline, const void* owner, const pcre2_code* code, const match_settings* settings, pcre2_match_context* context, const uint32_t check_interval)
+{
+    // The actual match limit is the lowest of the one of the settings and the one set in the pattern.
+    uint32_t match_limit = settings->match_limit;
+    uint32_t pattern_match_limit;
+
+    if (!match_limit)
+        pcre2_config(PCRE2_CONFIG_MATCHLIMIT, &match_limit);
+
+    if (pcre2_pattern_info(code, PCRE2_INFO_MATCHLIMIT, &pattern_match_limit) == 0 && pattern_match_limit < match_limit)
+        match_limit = pattern_match_limit;
+
+    pcre2_set_match_limit(context, pcrenet_deadline_enter(deadline, owner, match_limit, check_interval));
 }
 
 void PCRENET_SUFFIX(apply_settings)(const match_settings* settings, pcre2_match_context* context)
@@ -94,32 +293,95 @@ void PCRENET_SUFFIX(apply_settings)(const match_settings* settings, pcre2_match_
         pcre2_jit_stack_assign(context, NULL, settings->jit_stack);
 }
 
+static pcre2_match_data* create_range_match_data(const pcrenet_match_input* input)
+{
+    // The match data only needs to be large enough for the highest output group.
+    uint32_t pair_count = 1;
+
+    for (uint32_t i = 0; i < input->output_group_count; ++i)
+    {
+        if (input->output_groups[i] >= pair_count)
+            pair_count = input->output_groups[i] + 1;
+    }
+
+    return pcre2_match_data_create(pair_count, NULL);
+}
+
+static void copy_output_ranges(const pcrenet_match_input* input, const PCRE2_SIZE* ovector)
+{
+    size_t* output_vector = input->output_vector;
+
+    output_vector[0] = ovector[0];
+    output_vector[1] = ovector[1];
+
+    for (uint32_t i = 0; i < input->output_group_count; ++i)
+    {
+        const uint32_t group = input->output_groups[i];
+        output_vector[2 * i + 2] = ovector[2 * group];
+        output_vector[2 * i + 3] = ovector[2 * group + 1];
+    }
+}
+
 PCRENET_EXPORT(void, match)(const pcrenet_match_input* input, pcrenet_match_result* result)
 {
-    pcre2_match_data* match_data = pcre2_match_data_create_from_pattern(input->code, NULL);
-    pcre2_match_context* context = pcre2_match_context_create(NULL);
-    callout_data callout;
+    uint32_t options = input->additional_options;
+    result->result_code = PCRENET_SUFFIX(check_match_utf)(input->code, input->subject, input->subject_length, input->start_index, &options);
 
+    if (result->result_code != 0)
+    {
+        result->mark = NULL;
+        return;
+    }
+
+    pcre2_match_context* context = pcre2_match_context_create(NULL);
     PCRENET_SUFFIX(apply_settings)(&input->settings, context);
 
-    if (input->callout)
+    PCRE2_SIZE start_offset = input->start_index;
+
+    if (!PCRENET_SUFFIX(can_match)(input->code, input->subject, input->subject_length, &start_offset, options, context))
     {
-        callout.callout = input->callout;
-        callout.data = input->callout_data;
-        pcre2_set_callout(context, &callout_handler, &callout);
+        result->result_code = PCRE2_ERROR_NOMATCH;
+        result->mark = NULL;
+        pcre2_match_context_free(context);
+        return;
     }
 
+    pcre2_match_data* match_data = input->ranges_only
+        ? create_range_match_data(input)
+        : pcre2_match_data_create_from_pattern(input->code, NULL);
+
+    callout_data callout;
+    match_deadline deadline;
+    const int has_deadline = pcrenet_deadline_init(&deadline, &input->settings);
+
+    set_callout(context, &callout, input->callout, input->callout_data, &input->settings, NULL, NULL);
+
+    if (has_deadline)
+        PCRENET_SUFFIX(deadline_enter)(&deadline, &callout, input->code, &input->settings, context, PCRENET_DEADLINE_CHECK_INTERVAL);
+
     result->result_code = pcre2_match(
         input->code,
         input->subject,
         input->subject_length,
-        input->start_index,
-        input->additional_options,
+        start_offset,
+        options,
         match_data,
         context
     );
 
-    if (input->output_vector)
+    if (has_deadline)
+        pcrenet_deadline_leave(&deadline);
+
+    if (input->ranges_only)
+    {
+        // A zero result means the match data was too small for all the captures, which is expected here.
+        if (result->result_code == 0)
+            result->result_code = 1;
+
+        if ((result->result_code > 0 || result->result_code == PCRE2_ERROR_PARTIAL) && input->output_vector)
+            copy_output_ranges(input, pcre2_get_ovector_pointer(match_data));
+    }
+    else if (input->output_vector)
     {
         const PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(match_data);
         const uint32_t item_count = pcre2_get_ovector_count(match_data) * 2;
@@ -134,48 +396,111 @@ PCRENET_EXPORT(void, match)(const pcrenet_match_input* input, pcrenet_match_resu
 
 PCRENET_EXPORT(void, buffer_match)(const pcrenet_buffer_match_input* input, pcrenet_match_result* result)
 {
-    const match_buffer* buffer = input->buffer;
+    match_buffer* buffer = input->buffer;
     pcre2_match_context* match_context = buffer->match_context;
     pcre2_match_data* match_data = buffer->match_data;
+    pcrenet_match_stats* stats = buffer->settings.collect_stats ? &buffer->stats : NULL;
+    pcrenet_profile* profile = buffer->profile.entries ? &buffer->profile : NULL;
 
-    callout_data callout;
+    uint32_t options = input->additional_options;
+
+    if (stats)
+    {
+        // The JIT doesn't report the callout flags the statistics are based on.
+        memset(stats, 0, sizeof(pcrenet_match_stats));
+        options |= PCRE2_NO_JIT;
+    }
+
+    result->result_code = PCRENET_SUFFIX(check_match_utf)(buffer->code, input->subject, input->subject_length, input->start_index, &options);
 
-    if (input->callout)
+    if (result->result_code != 0)
     {
-        callout.callout = input->callout;
-        callout.data = input->callout_data;
-        pcre2_set_callout(match_context, &callout_handler, &callout);
+        result->mark = NULL;
+        return;
     }
-    else
+
+    PCRE2_SIZE start_offset = input->start_index;
+
+    if (!PCRENET_SUFFIX(can_match)(buffer->code, input->subject, input->subject_length, &start_offset, options, match_context))
     {
-        pcre2_set_callout(match_context, NULL, NULL);
+        result->result_code = PCRE2_ERROR_NOMATCH;
+        result->mark = NULL;
+
+        if (stats)
+        {
+            stats->skipped_length = input->subject_length - input->start_index + 1;
+            stats->heap_frames_size = pcre2_get_match_data_heapframes_size(match_data);
+        }
+
+        return;
     }
 
+    callout_data callout;
+    match_deadline deadline;
+    match_settings settings = buffer->settings;
+    settings.cancellation_flag = input->cancellation_flag;
+
+    const int has_deadline = pcrenet_deadline_init(&deadline, &settings);
+
+    if (profile)
+        profile->pending_entry = NULL;
+
+    set_callout(match_context, &callout, input->callout, input->callout_data, &settings, stats, profile);
+
+    if (has_deadline)
+        PCRENET_SUFFIX(deadline_enter)(&deadline, &callout, buffer->code, &settings, match_context, PCRENET_DEADLINE_CHECK_INTERVAL);
+
     result->result_code = pcre2_match(
         buffer->code,
         input->subject,
         input->subject_length,
-        input->start_index,
-        input->additional_options,
+        start_offset,
+        options,
         match_data,
         match_context
     );
 
+    if (has_deadline)
+    {
+        pcrenet_deadline_leave(&deadline);
+
+        // The context is reused by the next match of the buffer.
+        pcre2_set_match_limit(match_context, deadline.match_limit);
+    }
+
     result->mark = pcre2_get_mark(match_data);
+
+    if (stats)
+    {
+        // Every start position up to the last one tried is either tried or skipped by the start-of-match optimizations.
+        const PCRE2_SIZE last_start_position = result->result_code == PCRE2_ERROR_NOMATCH || stats->start_position_count == 0
+            ? input->subject_length
+            : callout.last_start_position;
+
+        const uint64_t candidate_count = (uint64_t)(last_start_position - input->start_index) + 1;
+
+        stats->skipped_length = candidate_count > stats->start_position_count
+            ? candidate_count - stats->start_position_count
+            : 0;
+
+        stats->heap_frames_size = pcre2_get_match_data_heapframes_size(match_data);
+    }
 }
 
 PCRENET_EXPORT(void, dfa_match)(const pcrenet_dfa_match_input* input, pcrenet_match_result* result)
 {
     pcre2_match_data* match_data = pcre2_match_data_create(input->max_results, NULL);
     pcre2_match_context* context = pcre2_match_context_create(NULL);
+    PCRENET_SUFFIX(apply_settings)(&input->settings, context);
+
     callout_data callout;
+    match_deadline deadline;
+    const int has_deadline = pcrenet_deadline_init(&deadline, &input->settings);
 
-    if (input->callout)
-    {
-        callout.callout = input->callout;
-        callout.data = input->callout_data;
-        pcre2_set_callout(context, &callout_handler, &callout);
-    }
+    set_callout(context, &callout, input->callout, input->callout_data, &input->settings, NULL, NULL);
+
+    if (has_deadline)
+        PCRENET_SUFFIX(deadline_enter)(&deadline, &callout, input->code, &input->settings, context, PCRENET_DFA_DEADLINE_CHECK_INTERVAL);
 
     const PCRE2_SIZE workspace_size = 20u > input->workspace_size ? 20u : input->workspace_size;
     int* workspace = malloc(workspace_size * sizeof(int));
@@ -192,6 +517,9 @@ PCRENET_EXPORT(void, dfa_match)(const pcrenet_dfa_match_input* input, pcrenet_ma
         workspace_size
     );
 
+    if (has_deadline)
+        pcrenet_deadline_leave(&deadline);
+
     if (input->output_vector)
     {
         const PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(match_data);
@@ -213,13 +541,47 @@ PCRENET_EXPORT(match_buffer*, create_match_buffer)(match_buffer_info* info)
     if (!buffer)
         return NULL;
 
+    memset(&buffer->profile, 0, sizeof(pcrenet_profile));
+    buffer->callout_filter = NULL;
+
+    if (info->settings.collect_profile && info->profile_length)
+    {
+        buffer->profile.entries = calloc(info->profile_length, sizeof(pcrenet_profile_entry));
+        buffer->profile.length = info->profile_length;
+        buffer->profile.countdown = PROFILE_SAMPLE_INTERVAL;
+
+        if (!buffer->profile.entries)
+        {
+            free(buffer);
+            return NULL;
+        }
+    }
+
+    if (info->settings.callout_filter)
+    {
+        // The filter is only guaranteed to be valid during this call.
+        buffer->callout_filter = copy_callout_filter(info->settings.callout_filter);
+
+        if (!buffer->callout_filter)
+        {
+            free(buffer->profile.entries);
+            free(buffer);
+            return NULL;
+        }
+    }
+
     buffer->code = info->code;
     buffer->match_data = pcre2_match_data_create_from_pattern(info->code, NULL);
     buffer->match_context = pcre2_match_context_create(NULL);
+    buffer->settings = info->settings;
+    buffer->settings.callout_filter = buffer->callout_filter;
+    memset(&buffer->stats, 0, sizeof(pcrenet_match_stats));
 
     PCRENET_SUFFIX(apply_settings)(&info->settings, buffer->match_context);
 
     info->output_vector = pcre2_get_ovector_pointer(buffer->match_data);
+    info->stats = info->settings.collect_stats ? &buffer->stats : NULL;
+    info->profile = buffer->profile.entries;
     return buffer;
 }
 
@@ -231,5 +593,7 @@ PCRENET_EXPORT(void, free_match_buffer)(match_buffer* buffer)
     pcre2_match_context_free(buffer->match_context);
     pcre2_match_data_free(buffer->match_data);
 
+    free(buffer->profile.entries);
+    free(buffer->callout_filter);
     free(buffer);
 }
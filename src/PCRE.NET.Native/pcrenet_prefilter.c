@@ -0,0 +1,391 @@
+#include <stddef.h>
+#include <string.h>
+#include "pcrenet.h"
+#include "pcrenet_bitmap.h"
+#include "../PCRE/src/pcre2_internal.h"
+
+// Detects subjects which cannot match before calling pcre2_match, using vectorized versions of its start-of-match optimizations.
+// When the interpreter is used, the start offset is also advanced to the first candidate position, unless this could change
+// the result: \G, \K and PCRE2_NOTEMPTY_ATSTART depend on the start offset.
+// The same data is exposed to managed code through get_prefilter_info, so subjects can be rejected without calling into native code.
+
+#define PUBLIC_MATCH_OPTIONS \
+    (PCRE2_ANCHORED | PCRE2_ENDANCHORED | PCRE2_NOTBOL | PCRE2_NOTEOL | PCRE2_NOTEMPTY | \
+     PCRE2_NOTEMPTY_ATSTART | PCRE2_NO_UTF_CHECK | PCRE2_PARTIAL_HARD | \
+     PCRE2_PARTIAL_SOFT | PCRE2_NO_JIT | PCRE2_COPY_MATCHED_SUBJECT | \
+     PCRE2_DISABLE_RECURSELOOP_CHECK)
+
+#define PUBLIC_JIT_MATCH_OPTIONS \
+    (PCRE2_NO_UTF_CHECK | PCRE2_NOTBOL | PCRE2_NOTEOL | PCRE2_NOTEMPTY | \
+     PCRE2_NOTEMPTY_ATSTART | PCRE2_PARTIAL_SOFT | PCRE2_PARTIAL_HARD | \
+     PCRE2_COPY_MATCHED_SUBJECT)
+
+// Below this length, building the lookup tables costs more than the scalar scan.
+#define BITMAP_SIMD_MIN_LENGTH 64
+
+// Skipping fewer code units than this doesn't pay for the pattern scan needed to advance the start offset.
+#define ADVANCE_MIN_DISTANCE 256
+
+// Flags of the data exposed to managed code by get_prefilter_info
+#define PREFILTER_ENABLED 0x01
+#define PREFILTER_FIRST_CODE_UNIT 0x02
+#define PREFILTER_START_BITMAP 0x04
+#define PREFILTER_LAST_CODE_UNIT 0x08
+#define PREFILTER_CAN_ADVANCE 0x10
+#define PREFILTER_CHECK_UTF 0x20
+
+typedef struct
+{
+    uint32_t flags;
+    uint32_t min_length;
+    uint32_t first_code_unit;
+    uint32_t first_code_unit2;
+    uint32_t last_code_unit;
+    uint32_t last_code_unit2;
+    uint8_t start_bitmap[32];
+} prefilter_info;
+
+static PCRE2_SPTR find_in_bitmap(PCRE2_SPTR ptr, PCRE2_SPTR end, const uint8_t* bitmap)
+{
+    if (end - ptr >= BITMAP_SIMD_MIN_LENGTH)
+    {
+#if PCRENET_SSE2 || PCRENET_NEON
+        uint8_t low_table[16];
+        uint8_t high_table[16];
+        build_bitmap_tables(bitmap, low_table, high_table);
+#endif
+
+#if PCRENET_SSE2
+        if (pcrenet_has_ssse3())
+            ptr = find_in_bitmap_ssse3(ptr, end, low_table, high_table);
+#elif PCRENET_NEON
+        ptr = find_in_bitmap_neon(ptr, end, low_table, high_table);
+#endif
+    }
+
+    while (ptr < end && !IN_BITMAP(bitmap, *ptr))
+        ++ptr;
+
+    return ptr;
+}
+
+static PCRE2_SPTR find_code_unit(PCRE2_SPTR ptr, PCRE2_SPTR end, const PCRE2_UCHAR c1, const PCRE2_UCHAR c2)
+{
+    // Finds the first occurrence of either c1 or c2, which are equal for caseful searches
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+    if (c1 == c2)
+    {
+        ptr = memchr(ptr, c1, (size_t)(end - ptr));
+        return ptr ? ptr : end;
+    }
+#endif
+
+#if PCRENET_SSE2
+    const size_t units_per_vector = 16 / sizeof(PCRE2_UCHAR);
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+    const __m128i first = _mm_set1_epi8((char)c1);
+    const __m128i second = _mm_set1_epi8((char)c2);
+#else
+    const __m128i first = _mm_set1_epi16((short)c1);
+    const __m128i second = _mm_set1_epi16((short)c2);
+#endif
+
+    while ((size_t)(end - ptr) >= units_per_vector)
+    {
+        const __m128i data = _mm_loadu_si128((const __m128i*)ptr);
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+        const __m128i found = _mm_or_si128(_mm_cmpeq_epi8(data, first), _mm_cmpeq_epi8(data, second));
+#else
+        const __m128i found = _mm_or_si128(_mm_cmpeq_epi16(data, first), _mm_cmpeq_epi16(data, second));
+#endif
+
+        const uint32_t mask = (uint32_t)_mm_movemask_epi8(found);
+
+        if (mask)
+            return ptr + pcrenet_ctz(mask) / sizeof(PCRE2_UCHAR);
+
+        ptr += units_per_vector;
+    }
+#elif PCRENET_NEON
+#if PCRE2_CODE_UNIT_WIDTH == 8
+    const uint8x16_t first = vdupq_n_u8(c1);
+    const uint8x16_t second = vdupq_n_u8(c2);
+
+    while (end - ptr >= 16)
+    {
+        const uint8x16_t data = vld1q_u8(ptr);
+
+        if (vmaxvq_u8(vorrq_u8(vceqq_u8(data, first), vceqq_u8(data, second))))
+            break;
+
+        ptr += 16;
+    }
+#else
+    const uint16x8_t first = vdupq_n_u16(c1);
+    const uint16x8_t second = vdupq_n_u16(c2);
+
+    while (end - ptr >= 8)
+    {
+        const uint16x8_t data = vld1q_u16(ptr);
+
+        if (vmaxvq_u16(vorrq_u16(vceqq_u16(data, first), vceqq_u16(data, second))))
+            break;
+
+        ptr += 8;
+    }
+#endif
+#endif
+
+    while (ptr < end && *ptr != c1 && *ptr != c2)
+        ++ptr;
+
+    return ptr;
+}
+
+static PCRE2_UCHAR get_other_case(const pcre2_real_code* re, const PCRE2_UCHAR c)
+{
+    // Same as the first_cu2 and req_cu2 computation in pcre2_match
+
+    PCRE2_UCHAR other = TABLE_GET(c, re->tables + fcc_offset, c);
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+    if (c > 127 && (re->overall_options & PCRE2_UCP) != 0 && (re->overall_options & PCRE2_UTF) == 0)
+        other = (PCRE2_UCHAR)UCD_OTHERCASE(c);
+#else
+    if (c > 127 && (re->overall_options & (PCRE2_UTF | PCRE2_UCP)) != 0)
+        other = (PCRE2_UCHAR)UCD_OTHERCASE(c);
+#endif
+
+    return other;
+}
+
+static int has_start_of_match_assertion(const pcre2_real_code* re)
+{
+    // Walks the compiled pattern looking for \G, the same way as PRIV(find_bracket)
+
+    PCRE2_SPTR code = (PCRE2_SPTR)((const uint8_t*)re + re->code_start);
+    const int utf = (re->overall_options & PCRE2_UTF) != 0;
+
+    for (;;)
+    {
+        const PCRE2_UCHAR c = *code;
+
+        if (c == OP_END)
+            return 0;
+
+        if (c == OP_SOM)
+            return 1;
+
+        if (c == OP_XCLASS || c == OP_ECLASS)
+        {
+            code += GET(code, 1);
+            continue;
+        }
+
+        if (c == OP_CALLOUT_STR)
+        {
+            code += GET(code, 1 + 2 * LINK_SIZE);
+            continue;
+        }
+
+        switch (c)
+        {
+            case OP_TYPESTAR:
+            case OP_TYPEMINSTAR:
+            case OP_TYPEPLUS:
+            case OP_TYPEMINPLUS:
+            case OP_TYPEQUERY:
+            case OP_TYPEMINQUERY:
+            case OP_TYPEPOSSTAR:
+            case OP_TYPEPOSPLUS:
+            case OP_TYPEPOSQUERY:
+                if (code[1] == OP_PROP || code[1] == OP_NOTPROP)
+                    code += 2;
+                break;
+
+            case OP_TYPEUPTO:
+            case OP_TYPEMINUPTO:
+            case OP_TYPEEXACT:
+            case OP_TYPEPOSUPTO:
+                if (code[1 + IMM2_SIZE] == OP_PROP || code[1 + IMM2_SIZE] == OP_NOTPROP)
+                    code += 2;
+                break;
+
+            case OP_MARK:
+            case OP_COMMIT_ARG:
+            case OP_PRUNE_ARG:
+            case OP_SKIP_ARG:
+            case OP_THEN_ARG:
+                code += code[1];
+                break;
+
+            default:
+                break;
+        }
+
+        code += PRIV(OP_lengths)[c];
+
+        // Skip the additional code units of a multi-unit character following the opcode
+        if (utf && c >= OP_CHAR && c <= OP_NOTPOSUPTOI && HAS_EXTRALEN(code[-1]))
+            code += GET_EXTRALEN(code[-1]);
+    }
+}
+
+static int can_advance(const pcre2_real_code* re, PCRE2_SPTR candidate, const uint32_t options)
+{
+    if ((options & PCRE2_NOTEMPTY_ATSTART) != 0
+        || (re->flags & PCRE2_HASBSK) != 0
+        || (re->overall_options & PCRE2_MATCH_INVALID_UTF) != 0)
+    {
+        return 0;
+    }
+
+    if ((re->overall_options & PCRE2_UTF) != 0 && NOT_FIRSTCU(*candidate))
+        return 0;
+
+    return !has_start_of_match_assertion(re);
+}
+
+static int is_heap_limit_too_low(const pcre2_real_code* re, const pcre2_real_match_context* mcontext)
+{
+    // pcre2_match fails with PCRE2_ERROR_HEAPLIMIT before applying the start-of-match optimizations if the limit is too low for a single frame
+
+    const PCRE2_SIZE frame_size = (offsetof(heapframe, ovector) + re->top_bracket * 2 * sizeof(PCRE2_SIZE) + HEAPFRAME_ALIGNMENT - 1) & ~(HEAPFRAME_ALIGNMENT - 1);
+
+    uint32_t heap_limit = mcontext ? mcontext->heap_limit : HEAP_LIMIT;
+    if (re->limit_heap < heap_limit)
+        heap_limit = re->limit_heap;
+
+    PCRE2_SIZE heapframes_size = frame_size * 10;
+    if (heapframes_size < START_FRAMES_SIZE)
+        heapframes_size = START_FRAMES_SIZE;
+
+    return heapframes_size / 1024 > heap_limit && 1024 * (PCRE2_SIZE)heap_limit < frame_size;
+}
+
+static int has_start_optimizations(const pcre2_real_code* re)
+{
+    return re->magic_number == MAGIC_NUMBER
+        && (re->flags & PCRE2_MODE_MASK) == PCRE2_CODE_UNIT_WIDTH / 8
+        && (re->overall_options & (PCRE2_ANCHORED | PCRE2_FIRSTLINE)) == 0
+        && (re->optimization_flags & PCRE2_OPTIM_START_OPTIMIZE) != 0;
+}
+
+int PCRENET_SUFFIX(can_match)(const pcre2_code* code, PCRE2_SPTR subject, const PCRE2_SIZE length, PCRE2_SIZE* start_offset, const uint32_t options, const pcre2_match_context* context)
+{
+    const pcre2_real_code* re = (const pcre2_real_code*)code;
+    const pcre2_real_match_context* mcontext = (const pcre2_real_match_context*)context;
+
+    // Leave any case which pcre2_match would report as an error, or where the optimizations don't apply, to pcre2_match itself
+
+    if (!re
+        || !subject
+        || *start_offset > length
+        || !has_start_optimizations(re)
+        || (options & ~PUBLIC_MATCH_OPTIONS) != 0
+        || (options & (PCRE2_PARTIAL_HARD | PCRE2_PARTIAL_SOFT | PCRE2_ANCHORED)) != 0
+        || (mcontext && mcontext->offset_limit != PCRE2_UNSET && (re->overall_options & PCRE2_USE_OFFSET_LIMIT) == 0))
+    {
+        return 1;
+    }
+
+    const int use_jit = re->executable_jit != NULL && (options & ~PUBLIC_JIT_MATCH_OPTIONS) == 0;
+
+    if (!use_jit && is_heap_limit_too_low(re, mcontext))
+        return 1;
+
+    PCRE2_SPTR start_match = subject + *start_offset;
+    PCRE2_SPTR const end_subject = subject + length;
+
+    if ((re->flags & PCRE2_FIRSTSET) != 0)
+    {
+        // The JIT compiler already uses SIMD instructions to search for the first code unit
+        if (!use_jit)
+        {
+            const PCRE2_UCHAR first_cu = (PCRE2_UCHAR)re->first_codeunit;
+            const PCRE2_UCHAR first_cu2 = (re->flags & PCRE2_FIRSTCASELESS) != 0 ? get_other_case(re, first_cu) : first_cu;
+
+            start_match = find_code_unit(start_match, end_subject, first_cu, first_cu2);
+
+            if (start_match == end_subject)
+                return 0;
+        }
+    }
+    else if ((re->flags & PCRE2_STARTLINE) == 0 && (re->flags & PCRE2_FIRSTMAPSET) != 0)
+    {
+        // Unlike the first code unit search, the JIT compiler scans the start bitmap one code unit at a time
+        start_match = find_in_bitmap(start_match, end_subject, re->start_bitmap);
+
+        if (start_match == end_subject)
+            return 0;
+    }
+
+    if ((PCRE2_SIZE)(end_subject - start_match) < re->minlength)
+        return 0;
+
+    if (use_jit)
+        return 1;
+
+    if ((re->flags & PCRE2_LASTSET) != 0)
+    {
+        // The required code unit needs to follow the first one, when it is set
+        const PCRE2_UCHAR req_cu = (PCRE2_UCHAR)re->last_codeunit;
+        const PCRE2_UCHAR req_cu2 = (re->flags & PCRE2_LASTCASELESS) != 0 ? get_other_case(re, req_cu) : req_cu;
+
+        if (find_code_unit(start_match + ((re->flags & PCRE2_FIRSTSET) != 0 ? 1 : 0), end_subject, req_cu, req_cu2) >= end_subject)
+            return 0;
+    }
+
+    if ((PCRE2_SIZE)(start_match - subject) - *start_offset >= ADVANCE_MIN_DISTANCE && can_advance(re, start_match, options))
+        *start_offset = (PCRE2_SIZE)(start_match - subject);
+
+    return 1;
+}
+
+PCRENET_EXPORT(void, get_prefilter_info)(const pcre2_code* code, prefilter_info* info)
+{
+    // Exposes the data used by can_match, so the same checks can be performed before calling into native code.
+    // Unlike pcre2_pattern_info, this tells whether the first and required code units are caseless.
+
+    const pcre2_real_code* re = (const pcre2_real_code*)code;
+
+    memset(info, 0, sizeof(prefilter_info));
+
+    if (!re || !has_start_optimizations(re) || is_heap_limit_too_low(re, NULL))
+        return;
+
+    info->flags = PREFILTER_ENABLED;
+    info->min_length = re->minlength;
+
+    if ((re->flags & PCRE2_FIRSTSET) != 0)
+    {
+        info->flags |= PREFILTER_FIRST_CODE_UNIT;
+        info->first_code_unit = re->first_codeunit;
+        info->first_code_unit2 = (re->flags & PCRE2_FIRSTCASELESS) != 0 ? get_other_case(re, (PCRE2_UCHAR)re->first_codeunit) : re->first_codeunit;
+    }
+    else if ((re->flags & PCRE2_STARTLINE) == 0 && (re->flags & PCRE2_FIRSTMAPSET) != 0)
+    {
+        info->flags |= PREFILTER_START_BITMAP;
+        memcpy(info->start_bitmap, re->start_bitmap, sizeof(info->start_bitmap));
+    }
+
+    if ((re->flags & PCRE2_LASTSET) != 0)
+    {
+        info->flags |= PREFILTER_LAST_CODE_UNIT;
+        info->last_code_unit = re->last_codeunit;
+        info->last_code_unit2 = (re->flags & PCRE2_LASTCASELESS) != 0 ? get_other_case(re, (PCRE2_UCHAR)re->last_codeunit) : re->last_codeunit;
+    }
+
+    if ((re->flags & PCRE2_HASBSK) == 0
+        && (re->overall_options & PCRE2_MATCH_INVALID_UTF) == 0
+        && !has_start_of_match_assertion(re))
+    {
+        info->flags |= PREFILTER_CAN_ADVANCE;
+    }
+
+    if ((re->overall_options & (PCRE2_UTF | PCRE2_MATCH_INVALID_UTF)) == PCRE2_UTF)
+        info->flags |= PREFILTER_CHECK_UTF;
+}
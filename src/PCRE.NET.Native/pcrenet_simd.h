@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+
+// SIMD support for the scanning helpers. SSE2 and NEON are part of the baseline ISA of the supported 64-bit platforms,
+// SSSE3 is detected at runtime.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define PCRENET_SSE2 1
+#   include <emmintrin.h>
+#   include <tmmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   define PCRENET_NEON 1
+#   include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#   define PCRENET_TARGET_SSSE3
+
+static inline uint32_t pcrenet_ctz(const uint32_t value)
+{
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return index;
+}
+#else
+#   define PCRENET_TARGET_SSSE3 __attribute__((target("ssse3")))
+#   define pcrenet_ctz(value) ((uint32_t)__builtin_ctz(value))
+#   if PCRENET_SSE2
+#       include <cpuid.h>
+#   endif
+#endif
+
+#if PCRENET_SSE2
+
+static inline int pcrenet_has_ssse3(void)
+{
+    static int state = -1;
+
+    if (state < 0)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        state = (info[2] & (1 << 9)) != 0;
+#else
+        unsigned int eax, ebx, ecx, edx;
+        state = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSSE3) != 0;
+#endif
+    }
+
+    return state;
+}
+
+#endif
@@ -149,6 +149,9 @@ static int match_callout_handler(pcre2_callout_block* block, void* data_ptr)
 {
     substitute_callout_data* data = data_ptr;
 
+    if (!PCRENET_SUFFIX(callout_filter_accepts)(data->input->settings.callout_filter, block))
+        return 0;
+
     uint8_t result;
     if (replay_queue_try_dequeue(&data->match_callout_queue, &result))
         return map_callout_result_byte_to_int(result);
@@ -204,8 +207,16 @@ static void call_substitute(const pcrenet_substitute_input* input,
 static void substitute_simple(const pcrenet_substitute_input* input,
                               pcrenet_substitute_result* result,
                               pcre2_match_data* match_data,
-                              pcre2_match_context* match_context)
+                              pcre2_match_context* match_context,
+                              match_deadline* deadline)
 {
+    // The deadline itself is the callout data which identifies the match when the deadline is checked.
+    if (deadline)
+    {
+        pcre2_set_callout(match_context, NULL, deadline);
+        PCRENET_SUFFIX(deadline_enter)(deadline, deadline, input->code, &input->settings, match_context, PCRENET_DEADLINE_CHECK_INTERVAL);
+    }
+
     // Try to substitute in one or two passes max using the PCRE2_SUBSTITUTE_OVERFLOW_LENGTH option
 
     result->output = input->buffer;
@@ -264,7 +275,8 @@ static void substitute_simple(const pcrenet_substitute_input* input,
 static void substitute_with_callout(const pcrenet_substitute_input* input,
                                     pcrenet_substitute_result* result,
                                     pcre2_match_data* match_data,
-                                    pcre2_match_context* match_context)
+                                    pcre2_match_context* match_context,
+                                    match_deadline* deadline)
 {
     result->output = input->buffer;
     result->output_length = 0;
@@ -283,8 +295,11 @@ static void substitute_with_callout(const pcrenet_substitute_input* input,
     replay_queue_init(&callout_data.match_callout_queue);
     replay_queue_init(&callout_data.substitute_callout_queue);
 
-    if (input->match_callout)
-        pcre2_set_callout(match_context, &match_callout_handler, &callout_data);
+    // The callout data is set even without a match callout, as it identifies the match when its deadline is checked.
+    pcre2_set_callout(match_context, input->match_callout ? &match_callout_handler : NULL, &callout_data);
+
+    if (deadline)
+        PCRENET_SUFFIX(deadline_enter)(deadline, &callout_data, input->code, &input->settings, match_context, PCRENET_DEADLINE_CHECK_INTERVAL);
 
     if (input->substitute_callout)
         pcre2_set_substitute_callout(match_context, &substitute_callout_handler, &callout_data);
@@ -367,10 +382,16 @@ PCRENET_EXPORT(void, substitute)(const pcrenet_substitute_input* input, pcrenet_
 
     result->substitute_call_count = 0;
 
+    match_deadline deadline;
+    match_deadline* active_deadline = pcrenet_deadline_init(&deadline, &input->settings) ? &deadline : NULL;
+
     if (!input->match_callout && !input->substitute_callout && !input->substitute_case_callout)
-        substitute_simple(input, result, match_data, match_context);
+        substitute_simple(input, result, match_data, match_context, active_deadline);
     else
-        substitute_with_callout(input, result, match_data, match_context);
+        substitute_with_callout(input, result, match_data, match_context, active_deadline);
+
+    if (active_deadline)
+        pcrenet_deadline_leave(active_deadline);
 
     pcre2_match_context_free(match_context);
     pcre2_match_data_free(match_data);
@@ -0,0 +1,152 @@
+#include "pcrenet.h"
+#include "pcrenet_simd.h"
+#include "../PCRE/src/pcre2_internal.h"
+
+// UTF validation which skips runs of code units that are valid on their own (ASCII bytes in UTF-8, non-surrogates in UTF-16)
+// using SIMD instructions, and falls back to the PCRE2 scalar validator for everything else.
+// A valid multi-unit sequence never contains such a unit, so each remaining run starts at a character boundary.
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+#   define IS_SINGLE_UNIT(c) ((c) < 0x80u)
+#else
+#   define IS_SINGLE_UNIT(c) (((c) & 0xf800u) != 0xd800u)
+#endif
+
+static PCRE2_SPTR skip_single_units(PCRE2_SPTR ptr, PCRE2_SPTR end)
+{
+#if PCRENET_SSE2
+    const size_t units_per_vector = 16 / sizeof(PCRE2_UCHAR);
+
+#if PCRE2_CODE_UNIT_WIDTH == 16
+    const __m128i surrogate_mask = _mm_set1_epi16((short)0xf800);
+    const __m128i surrogate_value = _mm_set1_epi16((short)0xd800);
+#endif
+
+    while ((size_t)(end - ptr) >= units_per_vector)
+    {
+        const __m128i data = _mm_loadu_si128((const __m128i*)ptr);
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+        const uint32_t mask = (uint32_t)_mm_movemask_epi8(data);
+#else
+        const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(data, surrogate_mask), surrogate_value));
+#endif
+
+        if (mask)
+            return ptr + pcrenet_ctz(mask) / sizeof(PCRE2_UCHAR);
+
+        ptr += units_per_vector;
+    }
+#elif PCRENET_NEON
+#if PCRE2_CODE_UNIT_WIDTH == 8
+    while (end - ptr >= 16)
+    {
+        if (vmaxvq_u8(vld1q_u8(ptr)) >= 0x80)
+            break;
+
+        ptr += 16;
+    }
+#else
+    const uint16x8_t surrogate_mask = vdupq_n_u16(0xf800);
+    const uint16x8_t surrogate_value = vdupq_n_u16(0xd800);
+
+    while (end - ptr >= 8)
+    {
+        if (vmaxvq_u16(vceqq_u16(vandq_u16(vld1q_u16(ptr), surrogate_mask), surrogate_value)))
+            break;
+
+        ptr += 8;
+    }
+#endif
+#endif
+
+    while (ptr < end && IS_SINGLE_UNIT(*ptr))
+        ++ptr;
+
+    return ptr;
+}
+
+int PCRENET_SUFFIX(valid_utf)(PCRE2_SPTR subject, const PCRE2_SIZE length, PCRE2_SIZE* error_offset)
+{
+    PCRE2_SPTR ptr = subject;
+    PCRE2_SPTR const end = subject + length;
+
+    for (;;)
+    {
+        ptr = skip_single_units(ptr, end);
+        if (ptr == end)
+            return 0;
+
+        PCRE2_SPTR run_end = ptr + 1;
+        while (run_end < end && !IS_SINGLE_UNIT(*run_end))
+            ++run_end;
+
+        if (PRIV(valid_utf)(ptr, (PCRE2_SIZE)(run_end - ptr), error_offset) != 0)
+        {
+            // Validate the rest of the subject to report the same error as a full scan would
+            const int rc = PRIV(valid_utf)(ptr, (PCRE2_SIZE)(end - ptr), error_offset);
+            *error_offset += (PCRE2_SIZE)(ptr - subject);
+            return rc;
+        }
+
+        ptr = run_end;
+    }
+}
+
+int PCRENET_SUFFIX(check_match_utf)(const pcre2_code* code, PCRE2_SPTR subject, const PCRE2_SIZE length, const PCRE2_SIZE start_offset, uint32_t* options)
+{
+    // This performs the same checks as pcre2_match, then sets PCRE2_NO_UTF_CHECK so they are not done again.
+
+    const pcre2_real_code* re = (const pcre2_real_code*)code;
+
+    if (!re
+        || (re->overall_options & PCRE2_UTF) == 0
+        || (re->overall_options & PCRE2_MATCH_INVALID_UTF) != 0
+        || (*options & PCRE2_NO_UTF_CHECK) != 0
+        || start_offset > length
+        || (!subject && length != 0))
+    {
+        return 0;
+    }
+
+    PCRE2_SPTR check_subject = subject + start_offset;
+
+    if (start_offset < length && NOT_FIRSTCU(*check_subject))
+    {
+        if (start_offset > 0)
+            return PCRE2_ERROR_BADUTFOFFSET;
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+        return PCRE2_ERROR_UTF8_ERR20;
+#else
+        return PCRE2_ERROR_UTF16_ERR3;
+#endif
+    }
+
+    for (uint32_t i = re->max_lookbehind; i > 0 && check_subject > subject; --i)
+    {
+        --check_subject;
+
+        while (check_subject > subject && NOT_FIRSTCU(*check_subject))
+            --check_subject;
+    }
+
+    PCRE2_SIZE error_offset;
+    const int rc = PCRENET_SUFFIX(valid_utf)(check_subject, length - (PCRE2_SIZE)(check_subject - subject), &error_offset);
+    if (rc != 0)
+        return rc;
+
+    *options |= PCRE2_NO_UTF_CHECK;
+    return 0;
+}
+
+PCRENET_EXPORT(int32_t, valid_utf)(PCRE2_SPTR subject, const uint32_t length, uint32_t* error_offset)
+{
+    PCRE2_SIZE offset = 0;
+    const int rc = PCRENET_SUFFIX(valid_utf)(subject, length, &offset);
+
+    if (error_offset)
+        *error_offset = rc != 0 ? (uint32_t)offset : 0;
+
+    return rc;
+}
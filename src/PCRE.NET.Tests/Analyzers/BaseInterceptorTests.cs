@@ -1,4 +1,5 @@
-using System;
+﻿using System;
+using System.Collections.Generic;
 using System.Diagnostics.CodeAnalysis;
 using System.IO;
 using System.Linq;
@@ -7,6 +8,7 @@ using System.Threading.Tasks;
 using JetBrains.Annotations;
 using Microsoft.CodeAnalysis;
 using Microsoft.CodeAnalysis.CSharp;
+using Microsoft.CodeAnalysis.Diagnostics;
 using NUnit.Framework;
 using VerifyNUnit;
 
@@ -15,7 +17,7 @@ namespace PCRE.Tests.Analyzers;
 public abstract class BaseInterceptorTests<TGenerator>
     where TGenerator : IIncrementalGenerator, new()
 {
-    protected static GeneratorDriverRunResult Generate(string input)
+    protected static GeneratorDriverRunResult Generate(string input, Dictionary<string, string>? globalOptions = null)
     {
         var runtimeDir = Path.GetDirectoryName(typeof(object).Assembly.Location)!;
 
@@ -40,7 +42,8 @@ public abstract class BaseInterceptorTests<TGenerator>
 
         var result = CSharpGeneratorDriver.Create(
                                               generators: [new TGenerator().AsSourceGenerator()],
-                                              parseOptions: parseOptions
+                                              parseOptions: parseOptions,
+                                              optionsProvider: new GlobalOptionsProvider(globalOptions ?? [])
                                           )
                                           .RunGeneratorsAndUpdateCompilation(compilation, out var updatedCompilation, out _)
                                           .GetRunResult();
@@ -84,4 +87,23 @@ public abstract class BaseInterceptorTests<TGenerator>
                            )
                        );
     }
+
+    private sealed class GlobalOptionsProvider(Dictionary<string, string> globalOptions) : AnalyzerConfigOptionsProvider
+    {
+        private static readonly AnalyzerConfigOptions _emptyOptions = new Options([]);
+
+        public override AnalyzerConfigOptions GlobalOptions { get; } = new Options(globalOptions);
+
+        public override AnalyzerConfigOptions GetOptions(SyntaxTree tree)
+            => _emptyOptions;
+
+        public override AnalyzerConfigOptions GetOptions(AdditionalText textFile)
+            => _emptyOptions;
+
+        private sealed class Options(Dictionary<string, string> options) : AnalyzerConfigOptions
+        {
+            public override bool TryGetValue(string key, [NotNullWhen(true)] out string? value)
+                => options.TryGetValue(key, out value);
+        }
+    }
 }
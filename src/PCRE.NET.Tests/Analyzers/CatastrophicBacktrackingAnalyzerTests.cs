@@ -0,0 +1,135 @@
+using System;
+using System.Collections.Immutable;
+using System.IO;
+using System.Linq;
+using System.Threading.Tasks;
+using Microsoft.CodeAnalysis;
+using Microsoft.CodeAnalysis.CSharp;
+using Microsoft.CodeAnalysis.Diagnostics;
+using NUnit.Framework;
+using PCRE.Analyzers;
+
+namespace PCRE.Tests.Analyzers;
+
+[TestFixture]
+public class CatastrophicBacktrackingAnalyzerTests
+{
+    [Test]
+    [TestCase(@"(a+)+$", "PCRE0001")]
+    [TestCase(@"(a*)*b", "PCRE0001")]
+    [TestCase(@"^(\w+\s?)*$", "PCRE0001")]
+    [TestCase(@"(?:(?<n>a+))*", "PCRE0001")]
+    [TestCase(@"(?x) ( a + ) + # comment", "PCRE0001")]
+    [TestCase(@"(?=(a+)+b)", "PCRE0001")]
+    [TestCase(@"(\w|\d)*x", "PCRE0002")]
+    [TestCase(@"(.|\s)*", "PCRE0002")]
+    [TestCase(@"(?i)(A|a)*", "PCRE0002")]
+    public async Task should_report_catastrophic_patterns(string pattern, string expectedId)
+    {
+        var diagnostics = await Analyze($"new PcreRegex({SymbolDisplay.FormatLiteral(pattern, true)})");
+
+        Assert.That(diagnostics.Select(static i => i.Id), Is.EqualTo(new[] { expectedId }));
+    }
+
+    [Test]
+    [TestCase(@"(a++)+$")]
+    [TestCase(@"(?>a+)+$")]
+    [TestCase(@"(a+)++$")]
+    [TestCase(@"(?>(a+)+)")]
+    [TestCase(@"(?=(a+)+)")]
+    [TestCase(@"(a|b)*")]
+    [TestCase(@"(?:foo|far)*")]
+    [TestCase(@"\d+(\.\d+)*")]
+    [TestCase(@"(?:[^""\\]|\\.)*")]
+    [TestCase(@"(?:\s*,\s*\w+)*")]
+    [TestCase(@"(A|a)*")]
+    [TestCase(@"( a + ) +")]
+    [TestCase(@"\Q(a+)+\E")]
+    [TestCase(@"(a+)\1*")]
+    [TestCase(@"[unclosed")]
+    public async Task should_not_report_safe_patterns(string pattern)
+    {
+        var diagnostics = await Analyze($"new PcreRegex({SymbolDisplay.FormatLiteral(pattern, true)})");
+
+        Assert.That(diagnostics, Is.Empty);
+    }
+
+    [Test]
+    [TestCase("""new PcreRegex("(a+)+", PcreOptions.Compiled)""")]
+    [TestCase("""new PcreRegexUtf8("(a+)+")""")]
+    [TestCase("""PcreRegex.IsMatch("subject", "(a+)+")""")]
+    [TestCase("""PcreRegex.Match("subject", "(a+)+", PcreOptions.None, 42)""")]
+    [TestCase("""PcreRegex.Matches("subject", "(a+)+")""")]
+    [TestCase("""PcreRegex.Replace("subject", "(a+)+", "b")""")]
+    [TestCase("""PcreRegex.Split("subject", "(a+)+")""")]
+    [TestCase("""PcreRegex.Substitute("subject", "(a+)+", "b")""")]
+    public async Task should_analyze_pcre_calls(string code)
+    {
+        var diagnostics = await Analyze(code);
+
+        Assert.That(diagnostics.Select(static i => i.Id), Is.EqualTo(new[] { "PCRE0001" }));
+    }
+
+    [Test]
+    [TestCase("""new PcreRegex(GetString())""")]
+    [TestCase("""new PcreRegex("(a+)+", GetOptions())""")]
+    [TestCase("""new PcreRegex("(a+)+", new PcreRegexSettings())""")]
+    [TestCase("""new PcreRegex("(a+)+", PcreOptions.Literal)""")]
+    [TestCase("""new PcreRegex(GetString()).IsMatch("(a+)+")""")]
+    public async Task should_not_analyze_unknown_patterns(string code)
+    {
+        var diagnostics = await Analyze(code);
+
+        Assert.That(diagnostics, Is.Empty);
+    }
+
+    [Test]
+    public async Task should_report_suggestion()
+    {
+        var diagnostics = await Analyze("""new PcreRegex(@"^(\w+\s?)*$")""");
+
+        Assert.That(diagnostics, Has.Length.EqualTo(1));
+        Assert.That(diagnostics[0].GetMessage(), Is.EqualTo(@"The quantifier '\w+' is repeated by '(\w+\s?)*', which may cause catastrophic backtracking. Consider using '\w++' instead."));
+        Assert.That(diagnostics[0].Location.SourceTree!.GetText().ToString(diagnostics[0].Location.SourceSpan), Is.EqualTo(@"@""^(\w+\s?)*$"""));
+    }
+
+    private static async Task<ImmutableArray<Diagnostic>> Analyze(string expression)
+    {
+        var runtimeDir = Path.GetDirectoryName(typeof(object).Assembly.Location)!;
+
+        var input = $$"""
+                      using PCRE;
+
+                      class C
+                      {
+                          void M()
+                          {
+                              _ = {{expression}};
+                          }
+
+                          static string GetString() => "foo";
+                          static PcreOptions GetOptions() => PcreOptions.None;
+                      }
+                      """;
+
+        var compilation = CSharpCompilation.Create("TestAssembly")
+                                           .AddReferences(
+                                               MetadataReference.CreateFromFile(typeof(object).Assembly.Location),
+                                               MetadataReference.CreateFromFile(typeof(PcreRegex).Assembly.Location),
+#if NETFRAMEWORK
+                                               MetadataReference.CreateFromFile(typeof(ReadOnlySpan<>).Assembly.Location),
+#elif FORCE_NET_STANDARD
+                                               MetadataReference.CreateFromFile(Path.Combine(runtimeDir, "System.Memory.dll")),
+#endif
+                                               MetadataReference.CreateFromFile(Path.Combine(runtimeDir, "netstandard.dll")),
+                                               MetadataReference.CreateFromFile(Path.Combine(runtimeDir, "System.Runtime.dll"))
+                                           )
+                                           .AddSyntaxTrees(CSharpSyntaxTree.ParseText(input))
+                                           .WithOptions(new CSharpCompilationOptions(OutputKind.DynamicallyLinkedLibrary).WithNullableContextOptions(NullableContextOptions.Enable));
+
+        Assert.That(compilation.GetDiagnostics().Where(static i => i.Severity == DiagnosticSeverity.Error), Is.Empty);
+
+        return await compilation.WithAnalyzers([new CatastrophicBacktrackingAnalyzer()])
+                                .GetAnalyzerDiagnosticsAsync();
+    }
+}
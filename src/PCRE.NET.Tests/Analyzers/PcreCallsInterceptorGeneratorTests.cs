@@ -1,4 +1,4 @@
-using System;
+﻿using System;
 using System.Linq;
 using System.Reflection;
 using System.Text;
@@ -129,6 +129,31 @@ public class PcreCallsInterceptorGeneratorTests : BaseInterceptorTests<PcreCalls
         );
     }
 
+    [Test]
+    [TestCase(null, false)]
+    [TestCase("", false)]
+    [TestCase("precompiled", true)]
+    public void registers_precompiled_patterns(string? directory, bool expected)
+    {
+        var result = Generate(
+            """
+            using PCRE;
+
+            class C
+            {
+                void M()
+                {
+                    _ = PcreRegex.Match("subject", "pattern");
+                }
+            }
+            """,
+            directory is not null ? new() { ["build_property.PcreNetPrecompiledPatterns"] = directory } : null
+        );
+
+        var generatedCode = result.GeneratedTrees.Single().ToString();
+        Assert.That(generatedCode.Contains("global::PCRE.PcrePersistentCache.AddPrecompiledPatterns(typeof(PcreCallsInterceptor).Assembly)"), Is.EqualTo(expected));
+    }
+
     [Test]
     public Task intercepts_only_expected_types()
     {
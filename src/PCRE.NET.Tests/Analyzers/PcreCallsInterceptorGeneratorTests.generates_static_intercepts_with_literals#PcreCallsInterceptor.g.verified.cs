@@ -29,6 +29,10 @@ namespace PCRE.Generated
             (global::PCRE.PcreOptions)0x0000000000000000
         );
 
+        [global::System.ThreadStatic]
+        private static global::PCRE.PcreMatchBuffer? _regex0Buffer;
+        private static global::PCRE.PcreMatchBuffer Regex0Buffer => _regex0Buffer ??= Regex0.CreateMatchBuffer();
+
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
         public static global::PCRE.PcreMatch Regex0_Call0_Match(string subject, string pattern)
@@ -36,7 +40,7 @@ namespace PCRE.Generated
 
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
         public static bool Regex0_Call1_IsMatch(string subject, string pattern)
-            => Regex0.IsMatch(subject: subject);
+            => Regex0Buffer.IsMatch(subject: subject);
 
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
@@ -78,13 +82,17 @@ namespace PCRE.Generated
             (global::PCRE.PcreOptions)0x0000000000000008
         );
 
+        [global::System.ThreadStatic]
+        private static global::PCRE.PcreMatchBuffer? _regex1Buffer;
+        private static global::PCRE.PcreMatchBuffer Regex1Buffer => _regex1Buffer ??= Regex1.CreateMatchBuffer();
+
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
         public static global::PCRE.PcreMatch Regex1_Call0_Match(string subject, string pattern, global::PCRE.PcreOptions options)
             => Regex1.Match(subject: subject);
 
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
         public static bool Regex1_Call1_IsMatch(string subject, string pattern, global::PCRE.PcreOptions options)
-            => Regex1.IsMatch(subject: subject);
+            => Regex1Buffer.IsMatch(subject: subject);
 
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
         public static global::PCRE.PcreMatch Regex1_Call2_Match(string subject, string pattern, global::PCRE.PcreOptions options, int startIndex)
@@ -92,7 +100,7 @@ namespace PCRE.Generated
 
         [global::System.Runtime.CompilerServices.InterceptsLocationAttribute(0, "...")]
         public static bool Regex1_Call3_IsMatch(string subject, string pattern, global::PCRE.PcreOptions options, int startIndex)
-            => Regex1.IsMatch(subject: subject, startIndex: startIndex);
+            => Regex1Buffer.IsMatch(subject: subject, startIndex: startIndex);
 
         private static global::PCRE.PcreRegex? _regex2;
         private static global::PCRE.PcreRegex Regex2 => _regex2 ??= new global::PCRE.PcreRegex(
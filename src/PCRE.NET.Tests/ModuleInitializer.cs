@@ -14,5 +14,10 @@ public static class ModuleInitializer
         DiffRunner.Disabled = true;
         VerifySourceGenerators.Initialize();
         VerifyDiffPlex.Initialize();
+
+#if CUSTOM_JIT_ALLOCATOR
+        // The PCRE.NET JIT allocator needs to be enabled before any pattern is compiled, so it is tested by a separate run of all the tests
+        PcreJitMemory.TryEnableCustomAllocator();
+#endif
     }
 }
@@ -0,0 +1,140 @@
+﻿using System;
+using System.Linq;
+using NUnit.Framework;
+using PCRE.Conversion;
+
+namespace PCRE.Tests.PcreNet.Conversion;
+
+[TestFixture]
+public class PcreGlobSetTests
+{
+    [Test]
+    [TestCase("foo.txt", "foo.txt", true)]
+    [TestCase("foo.txt", "foo.txtx", false)]
+    [TestCase("foo.txt", "src/foo.txt", false)]
+    [TestCase("*.cs", "foo.cs", true)]
+    [TestCase("*.cs", ".cs", true)]
+    [TestCase("*.cs", "src/foo.cs", false)]
+    [TestCase("*.cs", "foo.csx", false)]
+    [TestCase("**/*.cs", "src/foo.cs", true)]
+    [TestCase("**/*.cs", "foo.cs", true)]
+    [TestCase("*.tar.gz", "foo.tar.gz", true)]
+    [TestCase("*.tar.gz", "foo.gz", false)]
+    [TestCase("src/**", "src/foo.cs", true)]
+    [TestCase("src/**", "src/", true)]
+    [TestCase("src/**", "src", false)]
+    [TestCase("src/**", "srcx/foo.cs", false)]
+    [TestCase("src/lib/**", "src/lib/foo.cs", true)]
+    [TestCase("src/lib/**", "src/foo.cs", false)]
+    [TestCase("**", "any/path", true)]
+    [TestCase("a?c", "abc", true)]
+    [TestCase("a?c", "a/c", false)]
+    [TestCase("[ab]*.txt", "b.txt", true)]
+    [TestCase("[ab]*.txt", "c.txt", false)]
+    [TestCase("src/*/foo.cs", "src/lib/foo.cs", true)]
+    [TestCase("src/*/foo.cs", "src/lib/bar/foo.cs", false)]
+    [TestCase("**/obj/**", "src/obj/foo.cs", true)]
+    [TestCase(@"a\*b", "a*b", true)]
+    [TestCase(@"a\*b", "axb", false)]
+    public void should_match_globs(string glob, string path, bool expectedResult)
+    {
+        var options = PcreGlobConversionOptions.DefaultUnix();
+        var set = new PcreGlobSet([glob], options);
+
+        Assert.That(set.IsMatch(path), Is.EqualTo(expectedResult));
+        Assert.That(set.IsMatch(path.AsSpan()), Is.EqualTo(expectedResult));
+        Assert.That(set.GetMatchingGlobs(path), Is.EqualTo(expectedResult ? new[] { 0 } : Array.Empty<int>()));
+        Assert.That(new PcreRegex(PcreConvert.FromGlob(glob, options)).IsMatch(path), Is.EqualTo(expectedResult));
+    }
+
+    [Test]
+    public void should_report_all_matching_globs()
+    {
+        var set = new PcreGlobSet(["src/**", "*.cs", "**/*.cs", "src/[a-z]*.cs", "src/foo.cs", "**", "src/*/*.cs", "**/bar.cs"], PcreGlobConversionOptions.DefaultUnix());
+
+        Assert.That(set.Count, Is.EqualTo(8));
+        Assert.That(set.Globs[1], Is.EqualTo("*.cs"));
+        Assert.That(set.GetMatchingGlobs("src/foo.cs"), Is.EqualTo(new[] { 0, 2, 3, 4, 5 }));
+        Assert.That(set.GetMatchingGlobs("src/lib/bar.cs"), Is.EqualTo(new[] { 0, 2, 5, 6, 7 }));
+        Assert.That(set.GetMatchingGlobs("foo.cs"), Is.EqualTo(new[] { 1, 2, 5 }));
+    }
+
+    [Test]
+    public void should_match_like_converted_globs()
+    {
+        var globs = new[]
+        {
+            "foo.txt", "*.cs", "**/*.cs", "src/**", "a?c", "*.tar.gz", "**/obj/**", "src/*/x.cs", "[ab]*.txt", "*", "",
+            "src/lib/**", "**/*.min.js", "bin/**/*.dll", "**.cs", "docs/*.md", "**/x*", "x/**/y"
+        };
+
+        var parts = new[] { "foo.txt", "src", "lib", "x.cs", "obj", "bin", "abc", "x.tar.gz", "q.min.js", "docs", "r.md", "", "b.txt", "q.dll", "x", "y" };
+
+        foreach (var options in new[]
+                 {
+                     PcreGlobConversionOptions.DefaultUnix(),
+                     PcreGlobConversionOptions.DefaultWindows(),
+                     new PcreGlobConversionOptions { SeparatorCharacter = '/', EscapeCharacter = '\\', NoWildcardSeparator = true },
+                     new PcreGlobConversionOptions { SeparatorCharacter = '/', EscapeCharacter = '\\', NoStarStar = true }
+                 })
+        {
+            var separator = options.SeparatorCharacter.ToString();
+            var optionGlobs = globs.Select(i => i.Replace("/", separator)).ToArray();
+
+            var set = new PcreGlobSet(optionGlobs, options);
+            var regexes = optionGlobs.Select(i => new PcreRegex(PcreConvert.FromGlob(i, options))).ToArray();
+
+            var random = new Random(42);
+
+            for (var i = 0; i < 1000; ++i)
+            {
+                var path = string.Join(separator, Enumerable.Range(0, random.Next(1, 5)).Select(_ => parts[random.Next(parts.Length)]));
+                var expectedResult = Enumerable.Range(0, regexes.Length).Where(idx => regexes[idx].IsMatch(path)).ToArray();
+
+                Assert.That(set.GetMatchingGlobs(path), Is.EqualTo(expectedResult), path);
+                Assert.That(set.IsMatch(path), Is.EqualTo(expectedResult.Length != 0), path);
+            }
+        }
+    }
+
+    [Test]
+    public void should_match_many_globs()
+    {
+        var globs = Enumerable.Range(0, 2000)
+                              .Select(i => (i % 4) switch
+                              {
+                                  0 => $"dir{i}/**",
+                                  1 => $"*.ext{i}",
+                                  2 => $"src/file{i}.cs",
+                                  _ => $"lib{i}/*/f?{i}.txt"
+                              })
+                              .ToList();
+
+        var set = new PcreGlobSet(globs, PcreGlobConversionOptions.DefaultUnix());
+
+        Assert.That(set.GetMatchingGlobs("dir0/foo"), Is.EqualTo(new[] { 0 }));
+        Assert.That(set.GetMatchingGlobs("foo.ext1"), Is.EqualTo(new[] { 1 }));
+        Assert.That(set.GetMatchingGlobs("src/file2.cs"), Is.EqualTo(new[] { 2 }));
+        Assert.That(set.GetMatchingGlobs("lib1999/foo/fx1999.txt"), Is.EqualTo(new[] { 1999 }));
+        Assert.That(set.IsMatch("lib1999/foo/fx1999.txt"), Is.True);
+        Assert.That(set.IsMatch("lib1999/foo/fx1998.txt"), Is.False);
+    }
+
+    [Test]
+    public void should_match_empty_set()
+    {
+        var set = new PcreGlobSet([]);
+
+        Assert.That(set.Count, Is.EqualTo(0));
+        Assert.That(set.IsMatch("foo"), Is.False);
+        Assert.That(set.GetMatchingGlobs("foo"), Is.Empty);
+    }
+
+    [Test]
+    public void should_throw_on_invalid_glob()
+    {
+        Assert.Throws<PcreException>(() => _ = new PcreGlobSet(["[err"], PcreGlobConversionOptions.DefaultUnix()));
+        Assert.Throws<ArgumentException>(() => _ = new PcreGlobSet([null!], PcreGlobConversionOptions.DefaultUnix()));
+        Assert.Throws<ArgumentNullException>(() => _ = new PcreGlobSet(null!));
+    }
+}
@@ -136,4 +136,18 @@ public class DfaMatchTests
         valueRef = ref MemoryMarshal.GetReference(result.LongestMatch.ValueSpan);
         Assert.That(Unsafe.AreSame(ref valueRef, ref subjectRef), Is.True);
     }
+
+    [Test]
+    public void should_handle_match_timeout()
+    {
+        var re = new PcreRegex(@"(a|aa)+$");
+
+        var settings = new PcreDfaMatchSettings
+        {
+            Timeout = TimeSpan.FromMilliseconds(1)
+        };
+
+        Assert.Throws<PcreMatchTimeoutException>(() => re.Dfa.Match(new string('a', 5000) + "b", settings));
+        Assert.That(re.Dfa.Match("aaa", settings).Success, Is.True);
+    }
 }
@@ -5,6 +5,7 @@ using System.Linq;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using System.Text;
+using System.Threading;
 using NUnit.Framework;
 using PCRE.Internal;
 using PCRE.Tests.Support;
@@ -3861,6 +3862,48 @@ public class MatchTests
         Assert.That(ex.Message, Contains.Substring("1 byte missing at end"));
     }
 
+    [Test]
+    public void should_check_subject_utf_validity_in_long_subject()
+    {
+        var re = new PcreRegex(@"A");
+        var subject = new string('x', 1000) + "\uD800" + new string('x', 1000);
+
+        var ex = Assert.Throws<PcreMatchException>(() => _ = re.Match(subject))!;
+        Assert.That(ex.ErrorCode, Is.EqualTo(PcreErrorCode.Utf16Err2));
+
+        Assert.That(re.IsMatch(subject, 1001), Is.False);
+    }
+
+    [Test]
+    public void should_check_subject_utf_validity_in_long_subject_utf8()
+    {
+        var re = new PcreRegexUtf8(@"A"u8);
+        var subject = new byte[2001];
+        subject.AsSpan().Fill((byte)'x');
+        subject[1000] = 0xC3;
+
+        var ex = Assert.Throws<PcreMatchException>(() => _ = re.Match(subject))!;
+        Assert.That(ex.ErrorCode, Is.EqualTo(PcreErrorCode.Utf8Err6));
+
+        Assert.That(re.IsMatch(subject, 1001), Is.False);
+    }
+
+    [Test]
+    public void should_check_subject_utf_offset()
+    {
+        var re = new PcreRegex(@"A");
+        var ex = Assert.Throws<PcreMatchException>(() => _ = re.Match("A\uD83D\uDE00A", 2))!;
+        Assert.That(ex.ErrorCode, Is.EqualTo(PcreErrorCode.BadUtfOffset));
+    }
+
+    [Test]
+    public void should_check_subject_utf_offset_utf8()
+    {
+        var re = new PcreRegexUtf8(@"A"u8);
+        var ex = Assert.Throws<PcreMatchException>(() => _ = re.Match("AéA"u8, 2))!;
+        Assert.That(ex.ErrorCode, Is.EqualTo(PcreErrorCode.BadUtfOffset));
+    }
+
     [Test]
     public void should_not_check_subject_utf_validity_8bit()
     {
@@ -3975,6 +4018,443 @@ public class MatchTests
         Assert.That(match.Success, Is.False);
     }
 
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_handle_match_timeout(PcreOptions options)
+    {
+        var re = new PcreRegex(@"(a|aa)+$", options);
+        var subject = new string('a', 40) + "b";
+
+        var settings = new PcreMatchSettings
+        {
+            MatchLimit = uint.MaxValue,
+            Timeout = TimeSpan.FromMilliseconds(50)
+        };
+
+        var ex = Assert.Throws<PcreMatchTimeoutException>(() => re.Match(subject, 0, PcreMatchOptions.None, null, settings))!;
+        Assert.That(ex.ErrorCode, Is.EqualTo(PcreErrorCode.MatchTimeout));
+        Assert.That(ex.MatchTimeout, Is.EqualTo(settings.Timeout));
+
+        Assert.Throws<PcreMatchTimeoutException>(() => re.Match(subject.AsSpan(), 0, PcreMatchOptions.None, null, settings));
+
+        var match = re.Match("aaa", 0, PcreMatchOptions.None, null, settings);
+        Assert.That(match.Success, Is.True);
+        Assert.That(match.Groups[1].Value, Is.EqualTo("a"));
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_handle_match_timeout_buf(PcreOptions options)
+    {
+        var re = new PcreRegex(@"(a|aa)+$", options);
+        using var buffer = re.CreateMatchBuffer(new PcreMatchSettings
+        {
+            MatchLimit = uint.MaxValue,
+            Timeout = TimeSpan.FromMilliseconds(50)
+        });
+
+        Assert.Throws<PcreMatchTimeoutException>(() => buffer.Match(new string('a', 40) + "b"));
+        Assert.That(buffer.Match("aaa").Success, Is.True);
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_handle_match_timeout_utf8(PcreOptions options)
+    {
+        var re = new PcreRegexUtf8(@"(a|aa)+$"u8, options);
+
+        var settings = new PcreMatchSettings
+        {
+            MatchLimit = uint.MaxValue,
+            Timeout = TimeSpan.FromMilliseconds(50)
+        };
+
+        Assert.Throws<PcreMatchTimeoutException>(() => re.Match(Encoding.UTF8.GetBytes(new string('a', 40) + "b"), 0, PcreMatchOptions.None, null, settings));
+        Assert.That(re.Match("aaa"u8, 0, PcreMatchOptions.None, null, settings).Success, Is.True);
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_handle_match_cancellation(PcreOptions options)
+    {
+        var re = new PcreRegex(@"(a|aa)+$", options);
+        using var cts = new CancellationTokenSource(TimeSpan.FromMilliseconds(50));
+
+        var settings = new PcreMatchSettings
+        {
+            MatchLimit = uint.MaxValue,
+            CancellationToken = cts.Token
+        };
+
+        var ex = Assert.Catch<OperationCanceledException>(() => re.Match(new string('a', 40) + "b", 0, PcreMatchOptions.None, null, settings))!;
+        Assert.That(ex.CancellationToken, Is.EqualTo(cts.Token));
+
+        Assert.Catch<OperationCanceledException>(() => re.Match("aaa", 0, PcreMatchOptions.None, null, settings));
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_not_pass_automatic_callouts_to_user_callouts(PcreOptions options)
+    {
+        var re = new PcreRegex(@"a(?C1)b(?C{foo})c", options);
+        var settings = new PcreMatchSettings { Timeout = TimeSpan.FromSeconds(10) };
+        var callouts = new List<string>();
+
+        var match = re.Match("xabc", 0, PcreMatchOptions.None, callout =>
+        {
+            callouts.Add(callout.String ?? callout.Number.ToString());
+            return PcreCalloutResult.Pass;
+        }, settings);
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(callouts, Is.EqualTo(new[] { "1", "foo" }));
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_pass_explicit_callout_255_when_using_a_timeout(PcreOptions options)
+    {
+        var re = new PcreRegex(@"a(?C255)b", options);
+        var settings = new PcreMatchSettings { Timeout = TimeSpan.FromSeconds(10) };
+        var calloutCount = 0;
+
+        var match = re.Match("ab", 0, PcreMatchOptions.None, callout =>
+        {
+            Assert.That(callout.Number, Is.EqualTo(255));
+            ++calloutCount;
+            return PcreCalloutResult.Pass;
+        }, settings);
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(calloutCount, Is.EqualTo(1));
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_handle_match_timeout_with_explicit_callout_255(PcreOptions options)
+    {
+        var re = new PcreRegex(@"(?C255)(a|aa)+$", options);
+
+        var settings = new PcreMatchSettings
+        {
+            MatchLimit = uint.MaxValue,
+            Timeout = TimeSpan.FromMilliseconds(50)
+        };
+
+        Assert.Throws<PcreMatchTimeoutException>(() => re.Match(new string('a', 40) + "b", 0, PcreMatchOptions.None, null, settings));
+        Assert.Throws<PcreMatchTimeoutException>(() => re.Match(new string('a', 40) + "b", 0, PcreMatchOptions.None, _ => PcreCalloutResult.Pass, settings));
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_apply_match_limit_with_a_deadline(PcreOptions options)
+    {
+        // The deadline is checked when the match limit given to PCRE2 is reached, which must not change the actual limit.
+        var re = new PcreRegex(@"(a|aa)+$", options);
+
+        foreach (var length in new[] { 10, 16, 20 })
+        {
+            var subject = new string('a', length) + "b";
+
+            foreach (var matchLimit in new uint[] { 1, 100, 4095, 4096, 4097, 8192, 8193, 20000, 100000 })
+            {
+                var expected = GetResult(new PcreMatchSettings { MatchLimit = matchLimit });
+
+                Assert.That(GetResult(new PcreMatchSettings { MatchLimit = matchLimit, Timeout = TimeSpan.FromSeconds(10) }), Is.EqualTo(expected));
+
+                using var cts = new CancellationTokenSource();
+                Assert.That(GetResult(new PcreMatchSettings { MatchLimit = matchLimit, CancellationToken = cts.Token }), Is.EqualTo(expected));
+            }
+
+            PcreErrorCode GetResult(PcreMatchSettings settings)
+            {
+                try
+                {
+                    return re.Match(subject, 0, PcreMatchOptions.None, null, settings).Success ? PcreErrorCode.None : PcreErrorCode.NoMatch;
+                }
+                catch (PcreMatchException ex)
+                {
+                    return ex.ErrorCode;
+                }
+            }
+        }
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_handle_nested_matches_with_deadlines(PcreOptions options)
+    {
+        var re = new PcreRegex(@"a(?C1)b", options);
+        var innerRe = new PcreRegex(@"(a|aa)+$", options);
+        var innerSubject = new string('a', 40) + "b";
+        var settings = new PcreMatchSettings { Timeout = TimeSpan.FromSeconds(10) };
+
+        var match = re.Match("ab", 0, PcreMatchOptions.None, _ =>
+        {
+            var ex = Assert.Throws<PcreMatchException>(() => innerRe.Match(innerSubject, 0, PcreMatchOptions.None, null, new PcreMatchSettings { MatchLimit = 10000 }))!;
+            Assert.That(ex.ErrorCode, Is.EqualTo(PcreErrorCode.MatchLimit));
+
+            Assert.Throws<PcreMatchTimeoutException>(() => innerRe.Match(innerSubject, 0, PcreMatchOptions.None, null, new PcreMatchSettings
+            {
+                MatchLimit = uint.MaxValue,
+                Timeout = TimeSpan.FromMilliseconds(50)
+            }));
+
+            return PcreCalloutResult.Pass;
+        }, settings);
+
+        Assert.That(match.Success, Is.True);
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_filter_callouts(PcreOptions options)
+    {
+        var re = new PcreRegex(@"a(?C1)b(?C{foo})c(?C2)d(?C{bar})", options);
+        var callouts = new List<string>();
+
+        Func<PcreCallout, PcreCalloutResult> callout = data =>
+        {
+            callouts.Add(data.String ?? data.Number.ToString());
+            return PcreCalloutResult.Pass;
+        };
+
+        var match = re.Match("abcd", 0, PcreMatchOptions.None, callout, new PcreMatchSettings { CalloutFilter = PcreCalloutFilter.FromNumbers(2) });
+        Assert.That(match.Success, Is.True);
+        Assert.That(callouts, Is.EqualTo(new[] { "2" }));
+
+        callouts.Clear();
+        match = re.Match("abcd", 0, PcreMatchOptions.None, callout, new PcreMatchSettings { CalloutFilter = PcreCalloutFilter.FromStrings("bar") });
+        Assert.That(match.Success, Is.True);
+        Assert.That(callouts, Is.EqualTo(new[] { "bar" }));
+
+        callouts.Clear();
+        match = re.Match("abcd", 0, PcreMatchOptions.None, callout, new PcreMatchSettings { CalloutFilter = new PcreCalloutFilter([1], ["bar"]) });
+        Assert.That(match.Success, Is.True);
+        Assert.That(callouts, Is.EqualTo(new[] { "1", "bar" }));
+
+        callouts.Clear();
+        match = re.Match("abcd", 0, PcreMatchOptions.None, callout, new PcreMatchSettings { CalloutFilter = PcreCalloutFilter.None });
+        Assert.That(match.Success, Is.True);
+        Assert.That(callouts, Is.Empty);
+    }
+
+    [Test]
+    public void should_filter_callouts_ref()
+    {
+        var re = new PcreRegex(@"a(?C1)b(?C{foo})c(?C2)");
+        var settings = new PcreMatchSettings { CalloutFilter = PcreCalloutFilter.FromStrings("foo") };
+        var calls = 0;
+
+        var match = re.Match("abc".AsSpan(), 0, PcreMatchOptions.None, data =>
+        {
+            Assert.That(data.String, Is.EqualTo("foo"));
+            ++calls;
+            return PcreCalloutResult.Fail;
+        }, settings);
+
+        Assert.That(match.Success, Is.False);
+        Assert.That(calls, Is.EqualTo(1));
+    }
+
+    [Test]
+    public void should_filter_callouts_buf()
+    {
+        var re = new PcreRegex(@"a(?C1)b(?C{foo})c(?C2)");
+        using var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CalloutFilter = PcreCalloutFilter.FromNumbers(2) });
+        var calls = 0;
+
+        var match = buffer.Match("abc".AsSpan(), data =>
+        {
+            Assert.That(data.Number, Is.EqualTo(2));
+            ++calls;
+            return PcreCalloutResult.Pass;
+        });
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(calls, Is.EqualTo(1));
+    }
+
+    [Test]
+    public void should_filter_callouts_in_substitutions()
+    {
+        var re = new PcreRegex(@"a(?C1)|b(?C2)");
+        var settings = new PcreMatchSettings { CalloutFilter = PcreCalloutFilter.FromNumbers(2) };
+
+        var result = re.Substitute("abab", "x", 0, PcreSubstituteOptions.SubstituteGlobal, data => data.Number == 1 ? PcreCalloutResult.Fail : PcreCalloutResult.Pass, null, settings);
+
+        Assert.That(result, Is.EqualTo("xxxx"));
+    }
+
+    [Test]
+    public void should_reject_invalid_callout_filters()
+    {
+        Assert.Throws<ArgumentOutOfRangeException>(() => PcreCalloutFilter.FromNumbers(256));
+        Assert.Throws<ArgumentOutOfRangeException>(() => PcreCalloutFilter.FromNumbers(-1));
+        Assert.Throws<ArgumentNullException>(() => _ = new PcreCalloutFilter(null!, []));
+        Assert.Throws<ArgumentNullException>(() => _ = new PcreCalloutFilter([], null!));
+    }
+
+    [Test]
+    public void should_reuse_callouts()
+    {
+        var re = new PcreRegex(@"(a)(?C1)(b)?(?C2)c(?C{foo})");
+        var settings = new PcreMatchSettings { ReuseCallouts = true };
+        var callouts = new List<PcreCallout>();
+        var values = new List<string>();
+
+        var match = re.Match("abc", 0, PcreMatchOptions.None, data =>
+        {
+            callouts.Add(data);
+            values.Add($"{data.Number}:{data.String}:{data.Match.Value}:{data.Match[2].Success}");
+            return PcreCalloutResult.Pass;
+        }, settings);
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(callouts, Has.Count.EqualTo(3));
+        Assert.That(callouts, Has.All.SameAs(callouts[0]));
+        Assert.That(values, Is.EqualTo(new[] { "1::a:False", "2::ab:True", "0:foo:abc:True" }));
+    }
+
+    [Test]
+    public void should_not_reuse_callouts_by_default()
+    {
+        var re = new PcreRegex(@"a(?C1)b(?C2)");
+        var callouts = new List<PcreCallout>();
+
+        var match = re.Match("ab", data =>
+        {
+            callouts.Add(data);
+            return PcreCalloutResult.Pass;
+        });
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(callouts, Has.Count.EqualTo(2));
+        Assert.That(callouts[1], Is.Not.SameAs(callouts[0]));
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_enumerate_match_ranges(PcreOptions options)
+    {
+        var re = new PcreRegex(@"(?<a>\w)(\w)?|(x)", options);
+        const string subject = "ab c d,,e";
+
+        var ranges = new List<(int, int)>();
+
+        foreach (var range in re.EnumerateMatchRanges(subject.AsSpan()))
+            ranges.Add((range.Index, range.Length));
+
+        Assert.That(ranges, Is.EqualTo(re.Matches(subject).Select(m => (m.Index, m.Length))));
+    }
+
+    [Test]
+    public void should_enumerate_empty_match_ranges()
+    {
+        var re = new PcreRegex("x*");
+        const string subject = "axxb";
+
+        var ranges = new List<(int, int)>();
+
+        foreach (var range in re.EnumerateMatchRanges(subject.AsSpan()))
+            ranges.Add((range.Index, range.EndIndex));
+
+        Assert.That(ranges, Is.EqualTo(re.Matches(subject).Select(m => (m.Index, m.EndIndex))));
+    }
+
+    [Test]
+    public void should_enumerate_match_ranges_from_start_index()
+    {
+        var re = new PcreRegex(@"\d+");
+
+        var ranges = new List<int>();
+
+        foreach (var range in re.EnumerateMatchRanges("1 22 333".AsSpan(), 2))
+            ranges.Add(range.Index);
+
+        Assert.That(ranges, Is.EqualTo(new[] { 2, 5 }));
+    }
+
+    [Test]
+    public void should_enumerate_match_ranges_with_selected_groups()
+    {
+        var re = new PcreRegex(@"(?<a>\w)(\w)?|(x)");
+        const string subject = "ab c";
+
+        Span<PcreMatchRange> groupRanges = stackalloc PcreMatchRange[2];
+        var results = new List<string>();
+
+        foreach (var range in re.EnumerateMatchRanges(subject.AsSpan(), 0, PcreMatchOptions.None, [2, 1], groupRanges))
+            results.Add($"{range} {groupRanges[0]} {groupRanges[1]}");
+
+        Assert.That(results, Is.EqualTo(new[] { "0..2 1..2 0..1", "3..4 <unset> 3..4" }));
+    }
+
+    [Test]
+    public void should_enumerate_match_ranges_with_many_groups()
+    {
+        var re = new PcreRegex(string.Concat(Enumerable.Repeat("(.)", 2 * InternalRegex.MaxStackAllocCaptureCount)));
+        var subject = new string('a', 5 * InternalRegex.MaxStackAllocCaptureCount);
+
+        Assert.That(re.EnumerateMatchRanges(subject.AsSpan()).Count(), Is.EqualTo(2));
+        Assert.That(re.IsMatch(subject), Is.True);
+
+        var groups = Enumerable.Range(1, 2 * InternalRegex.MaxStackAllocCaptureCount).ToArray();
+        var groupRanges = new PcreMatchRange[groups.Length];
+
+        foreach (var range in re.EnumerateMatchRanges(subject.AsSpan(), 0, PcreMatchOptions.None, groups, groupRanges))
+            Assert.That(groupRanges.Select(i => i.Index), Is.EqualTo(Enumerable.Range(range.Index, groups.Length)));
+    }
+
+    [Test]
+    public void should_enumerate_match_ranges_utf8()
+    {
+        var re = new PcreRegexUtf8(@"\p{L}+"u8);
+
+        var ranges = new List<(int, int)>();
+
+        foreach (var range in re.EnumerateMatchRanges("é ab"u8))
+            ranges.Add((range.Index, range.Length));
+
+        Assert.That(ranges, Is.EqualTo(new[] { (0, 2), (3, 2) }));
+    }
+
+    [Test]
+    public void should_reject_invalid_match_range_groups()
+    {
+        var re = new PcreRegex(@"(a)(b)");
+
+        Assert.Throws<ArgumentOutOfRangeException>(() => re.EnumerateMatchRanges("ab".AsSpan(), 0, PcreMatchOptions.None, [3], new PcreMatchRange[1]));
+        Assert.Throws<ArgumentOutOfRangeException>(() => re.EnumerateMatchRanges("ab".AsSpan(), 0, PcreMatchOptions.None, [-1], new PcreMatchRange[1]));
+        Assert.Throws<ArgumentException>(() => re.EnumerateMatchRanges("ab".AsSpan(), 0, PcreMatchOptions.None, [1], new PcreMatchRange[2]));
+        Assert.Throws<ArgumentOutOfRangeException>(() => re.EnumerateMatchRanges("ab".AsSpan(), 3));
+    }
+
+    [Test]
+    public void should_validate_match_timeout()
+    {
+        var settings = new PcreMatchSettings();
+        Assert.That(settings.Timeout, Is.EqualTo(Timeout.InfiniteTimeSpan));
+
+        Assert.Throws<ArgumentOutOfRangeException>(() => settings.Timeout = TimeSpan.Zero);
+        Assert.Throws<ArgumentOutOfRangeException>(() => settings.Timeout = TimeSpan.FromSeconds(-1));
+        Assert.Throws<ArgumentOutOfRangeException>(() => settings.Timeout = TimeSpan.MaxValue);
+
+        settings.Timeout = TimeSpan.FromSeconds(1);
+        settings.Timeout = Timeout.InfiniteTimeSpan;
+    }
+
     [Test]
     public void should_handle_offset_limit_8bit()
     {
@@ -4444,6 +4924,107 @@ public class MatchTests
         Assert.That(regex.Match("4M").Value, Is.EqualTo("M"));
     }
 
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_match_start_bitmap_pattern_in_long_subject(PcreOptions options)
+    {
+        var regex = new PcreRegex(@"[A-Za-z_]\w*=", options);
+        var padding = new string('1', 1000);
+
+        var match = regex.Match(padding + "foo=" + padding);
+        Assert.That(match.Success, Is.True);
+        Assert.That(match.Index, Is.EqualTo(1000));
+        Assert.That(match.Value, Is.EqualTo("foo="));
+
+        Assert.That(regex.IsMatch(padding + "foo" + padding), Is.False);
+        Assert.That(regex.IsMatch(padding + "=" + padding), Is.False);
+        Assert.That(regex.IsMatch(padding + "foo=", 1004), Is.False);
+        Assert.That(regex.IsMatch(padding + "foo=", 1001), Is.True);
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_match_start_bitmap_pattern_with_wide_characters_in_long_subject(PcreOptions options)
+    {
+        var regex = new PcreRegex(@"[a\x{20AC}]b", options);
+        var padding = new string('1', 1000);
+
+        Assert.That(regex.Match(padding + "\u20ACb").Index, Is.EqualTo(1000));
+        Assert.That(regex.Match(padding + "ab").Index, Is.EqualTo(1000));
+        Assert.That(regex.IsMatch(padding + "\u00FFb"), Is.False);
+        Assert.That(regex.IsMatch(padding + "\u20ACc"), Is.False);
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_match_start_bitmap_pattern_in_long_subject_utf8(PcreOptions options)
+    {
+        var regex = new PcreRegexUtf8(@"[A-Za-z_é]\w*="u8, options);
+        var padding = new string('1', 1000);
+
+        var match = regex.Match(Encoding.UTF8.GetBytes(padding + "éfoo=" + padding));
+        Assert.That(match.Success, Is.True);
+        Assert.That(match.Index, Is.EqualTo(1000));
+
+        Assert.That(regex.IsMatch(Encoding.UTF8.GetBytes(padding + "=" + padding)), Is.False);
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_match_caseless_first_code_unit_in_long_subject(PcreOptions options)
+    {
+        var regex = new PcreRegex(@"(?i)hello", options);
+        var padding = new string('1', 1000);
+
+        Assert.That(regex.Match(padding + "HeLLo" + padding).Index, Is.EqualTo(1000));
+        Assert.That(regex.Match(padding + "hello").Index, Is.EqualTo(1000));
+        Assert.That(regex.IsMatch(padding + "hell" + padding), Is.False);
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_check_required_code_unit_in_long_subject(PcreOptions options)
+    {
+        var regex = new PcreRegex(@"h.*z", options);
+        var padding = new string('1', 1000);
+
+        Assert.That(regex.IsMatch(padding + "h" + padding), Is.False);
+        Assert.That(regex.IsMatch(padding + "z" + padding + "h"), Is.False);
+        Assert.That(regex.Match(padding + "h" + padding + "z").Index, Is.EqualTo(1000));
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_keep_start_of_match_assertion_semantics_in_long_subject(PcreOptions options)
+    {
+        var padding = new string('1', 1000);
+
+        var lookbehind = new PcreRegex(@"(?<=\G.)a", options);
+        Assert.That(lookbehind.IsMatch(padding + "a"), Is.False);
+        Assert.That(lookbehind.Match(padding + "a", 999).Index, Is.EqualTo(1000));
+
+        var optional = new PcreRegex(@"x?\Gb", options);
+        Assert.That(optional.IsMatch(padding + "b"), Is.False);
+        Assert.That(optional.Match(padding + "b", 1000).Index, Is.EqualTo(1000));
+    }
+
+    [Test]
+    public void should_match_start_bitmap_pattern_in_long_subject_buf()
+    {
+        var regex = new PcreRegex(@"[A-Za-z_]\w*=");
+        var buffer = regex.CreateMatchBuffer();
+        var padding = new string('1', 1000);
+
+        Assert.That(buffer.Match(padding + "foo=").Index, Is.EqualTo(1000));
+        Assert.That(buffer.IsMatch(padding + "foo"), Is.False);
+    }
+
     [Test]
     public void should_throw_on_null_subject()
     {
@@ -4808,6 +5389,263 @@ public class MatchTests
         Assert.That(autoPossess, Is.EqualTo(expectedAutoPossess));
     }
 
+    [Test]
+    [TestCase("foo", PcreOptions.None)]
+    [TestCase("foo", PcreOptions.Compiled)]
+    [TestCase("FoO", PcreOptions.IgnoreCase)]
+    [TestCase("(?i)FoO", PcreOptions.None)]
+    [TestCase("a b", PcreOptions.None)]
+    [TestCase("a b", PcreOptions.Extended)]
+    [TestCase("f.o", PcreOptions.Literal)]
+    [TestCase("(?i)kiss", PcreOptions.None)]
+    [TestCase("(?i)kiss", PcreOptions.Ucp)]
+    [TestCase("foo", PcreOptions.MultiLine | PcreOptions.DotAll)]
+    public void should_match_literal_patterns_like_pcre(string pattern, PcreOptions options)
+    {
+        var re = new PcreRegex(pattern, options);
+        var subjects = new[] { "", "foo", "xfoofOOFoo", "f.o fxo", "a b ab", "KISS kiss \u212Aiss \u017Fs", "\u00e9foo\u00e9", "fo" };
+
+        var pcreSettings = new PcreMatchSettings();
+
+        foreach (var subject in subjects)
+        {
+            for (var startIndex = 0; startIndex <= subject.Length; ++startIndex)
+            {
+                foreach (var matchOptions in new[] { PcreMatchOptions.None, PcreMatchOptions.NotBol, PcreMatchOptions.NotEmpty })
+                {
+                    var match = re.Match(subject, startIndex, matchOptions);
+                    var expected = re.Match(subject, startIndex, matchOptions | PcreMatchOptions.NoJit);
+
+                    Assert.That(match.Success, Is.EqualTo(expected.Success));
+                    Assert.That(match.Index, Is.EqualTo(expected.Index));
+                    Assert.That(match.Length, Is.EqualTo(expected.Length));
+                }
+            }
+
+            Assert.That(re.Matches(subject).Select(m => m.Index), Is.EqualTo(re.Matches(subject, 0, PcreMatchOptions.NoJit, null, pcreSettings).Select(m => m.Index)));
+            Assert.That(re.IsMatch(subject.AsSpan()), Is.EqualTo(re.Match(subject, PcreMatchOptions.NoJit).Success));
+            Assert.That(re.Replace(subject, "<$&>"), Is.EqualTo(string.Concat(SplitOnMatches(subject, re.Matches(subject, 0, PcreMatchOptions.NoJit, null, pcreSettings).ToList()))));
+        }
+
+        static IEnumerable<string> SplitOnMatches(string subject, List<PcreMatch> matches)
+        {
+            var index = 0;
+
+            foreach (var match in matches)
+            {
+                yield return subject.Substring(index, match.Index - index);
+                yield return $"<{match.Value}>";
+                index = match.EndIndex;
+            }
+
+            yield return subject.Substring(index);
+        }
+    }
+
+    [Test]
+    public void should_match_literal_patterns_8bit()
+    {
+        var re = new PcreRegexUtf8("(?i)NEEDLE"u8, PcreOptions.None);
+        var subject = "hay \u00e9 needle NeEdLe"u8;
+
+        Assert.That(re.Match(subject).Index, Is.EqualTo(re.Match(subject, PcreMatchOptions.NoJit).Index));
+        Assert.That(re.Match(subject).Index, Is.EqualTo(7));
+
+        var latin1 = TestSupport.CreatePcreRegex8Bit("b\u00e9".ToLatin1Bytes(), PcreOptions.None);
+        Assert.That(latin1.Match("ab\u00e9".ToLatin1Bytes()).Index, Is.EqualTo(1));
+    }
+
+    [Test]
+    public void should_fall_back_to_pcre_for_literal_patterns()
+    {
+        var re = new PcreRegex("foo");
+
+        var partialMatch = re.Match("xfo", PcreMatchOptions.PartialSoft);
+        Assert.That(partialMatch.IsPartialMatch, Is.True);
+        Assert.That(partialMatch.Index, Is.EqualTo(1));
+
+        Assert.That(re.Match("\uD83D\uDE00foo").Index, Is.EqualTo(2));
+        Assert.Throws<PcreMatchException>(() => re.Match("\uD800foo"));
+        Assert.That(re.Match("\uD800foo", PcreMatchOptions.NoUtfCheck).Index, Is.EqualTo(1));
+    }
+
+    [Test]
+    [TestCase(@"\d{3}-\d{4}", PcreOptions.None)]
+    [TestCase(@"\d{3}-\d{4}", PcreOptions.Compiled)]
+    [TestCase(@"(?i)error: \w+", PcreOptions.None)]
+    [TestCase(@"[#@]\w+", PcreOptions.Compiled)]
+    [TestCase(@"x.*yz", PcreOptions.None)]
+    [TestCase(@"\Gfoo", PcreOptions.None)]
+    [TestCase(@"a\Kb", PcreOptions.None)]
+    [TestCase(@"(*MARK:A)xyz|(*MARK:B)q", PcreOptions.None)]
+    [TestCase(@"(?<=x)ab|\x{1F600}a", PcreOptions.None)]
+    [TestCase(@"(?i)\x{e9}.+\x{fc}", PcreOptions.Ucp)]
+    public void should_prefilter_subjects_like_pcre(string pattern, PcreOptions options)
+    {
+        var re = new PcreRegex(pattern, options);
+        var subjects = new[] { "", "hello world", "call 555-1234 now", "ERROR: disk full", "@user #tag", "x--yz", "foofoo", "xab ab", "xyz q", "\U0001F600a", "\u00c9t\u00dc", new string('-', 500) + "xab 555-1234" };
+
+        // A heap limit disables the managed prefilter
+        var nativeSettings = new PcreMatchSettings { HeapLimit = 1000000 };
+
+        foreach (var subject in subjects)
+        {
+            for (var startIndex = 0; startIndex <= subject.Length; ++startIndex)
+            {
+                if (startIndex < subject.Length && char.IsLowSurrogate(subject[startIndex]))
+                    continue;
+
+                foreach (var matchOptions in new[] { PcreMatchOptions.None, PcreMatchOptions.NotEmptyAtStart, PcreMatchOptions.NoJit, PcreMatchOptions.Anchored })
+                {
+                    var match = re.Match(subject, startIndex, matchOptions, null, new PcreMatchSettings());
+                    var expected = re.Match(subject, startIndex, matchOptions, null, nativeSettings);
+
+                    Assert.That(match.Success, Is.EqualTo(expected.Success));
+                    Assert.That(match.Index, Is.EqualTo(expected.Index));
+                    Assert.That(match.Length, Is.EqualTo(expected.Length));
+                    Assert.That(match.Mark, Is.EqualTo(expected.Mark));
+                }
+            }
+
+            Assert.That(re.IsMatch(subject), Is.EqualTo(re.Match(subject, 0, PcreMatchOptions.None, null, nativeSettings).Success));
+        }
+    }
+
+    [Test]
+    public void should_prefilter_subjects_8bit()
+    {
+        var re = new PcreRegexUtf8(@"\d{3}-\d{4}"u8, PcreOptions.Compiled);
+
+        Assert.That(re.IsMatch("hello world"u8), Is.False);
+        Assert.That(re.IsMatch("call 555-1234"u8), Is.True);
+        Assert.That(re.Match("caf\u00e9 555-1234"u8).Index, Is.EqualTo(6));
+    }
+
+    [Test]
+    public void should_not_prefilter_invalid_subjects()
+    {
+        var re = new PcreRegex(@"\d+");
+
+        Assert.Throws<PcreMatchException>(() => re.IsMatch("\uD800abc"));
+        Assert.That(re.Match("\uD800abc", PcreMatchOptions.NoUtfCheck).Success, Is.False);
+        Assert.That(re.Match("abc", PcreMatchOptions.PartialSoft).IsPartialMatch, Is.False);
+        Assert.That(re.Match("abc1", PcreMatchOptions.PartialSoft).Index, Is.EqualTo(3));
+    }
+
+    [Test]
+    [TestCase(@"[a-z0-9._-]+@")]
+    [TestCase(@"[a-z0-9._-]*@")]
+    [TestCase(@"\d+;")]
+    [TestCase(@"\d+\d")]
+    [TestCase(@"\d{1,20};")]
+    [TestCase(@"\d{1,20}+")]
+    [TestCase(@"\d{2,};")]
+    [TestCase(@"(\w+)\b")]
+    [TestCase(@"\S+ ")]
+    [TestCase(@"\s*+x")]
+    [TestCase(@"\D+")]
+    [TestCase(@"[^;]+;")]
+    [TestCase(@"[^;]*;a")]
+    [TestCase(@"(?i)[^e]+e")]
+    [TestCase(@"[^\x{e9}]+")]
+    [TestCase(@"[\x00-\xff]+")]
+    [TestCase(@"^(\d+;)(?1)")]
+    public void should_match_long_class_runs_like_the_interpreter(string pattern)
+    {
+        var re = new PcreRegex(pattern, PcreOptions.Compiled | PcreOptions.CompiledPartial);
+        var reUtf8 = new PcreRegexUtf8(pattern, PcreOptions.Compiled | PcreOptions.CompiledPartial);
+
+        var subjects = new[]
+        {
+            new string('a', 100) + "@",
+            new string('7', 100) + ";" + new string('7', 40) + ";",
+            new string('7', 31) + "x" + new string('7', 40) + ";",
+            new string('7', 100),
+            new string('x', 40) + " " + new string(' ', 40) + "x",
+            new string('E', 40) + "e",
+            new string('a', 50) + "\u00e9" + new string('a', 50) + "\u0100" + new string('a', 50),
+            new string('a', 50) + "\U0001F600" + new string('a', 50) + ";a",
+            new string('\u00ff', 50) + "\u0100" + new string('z', 50)
+        };
+
+        // Bounded repeats and partial matching don't use the vectorized scan, but must still match runs as the interpreter does
+        foreach (var subject in subjects)
+        {
+            foreach (var matchOptions in new[] { PcreMatchOptions.None, PcreMatchOptions.PartialSoft, PcreMatchOptions.PartialHard })
+            {
+                var expected = re.Match(subject, matchOptions | PcreMatchOptions.NoJit);
+                var match = re.Match(subject, matchOptions);
+
+                Assert.That(match.Success, Is.EqualTo(expected.Success));
+                Assert.That(match.IsPartialMatch, Is.EqualTo(expected.IsPartialMatch));
+                Assert.That(match.Index, Is.EqualTo(expected.Index));
+                Assert.That(match.Length, Is.EqualTo(expected.Length));
+
+                var utf8Subject = Encoding.UTF8.GetBytes(subject);
+                var expectedUtf8 = reUtf8.Match(utf8Subject, matchOptions | PcreMatchOptions.NoJit);
+                var matchUtf8 = reUtf8.Match(utf8Subject, matchOptions);
+
+                Assert.That(matchUtf8.Success, Is.EqualTo(expectedUtf8.Success));
+                Assert.That(matchUtf8.IsPartialMatch, Is.EqualTo(expectedUtf8.IsPartialMatch));
+                Assert.That(matchUtf8.Index, Is.EqualTo(expectedUtf8.Index));
+                Assert.That(matchUtf8.Length, Is.EqualTo(expectedUtf8.Length));
+            }
+        }
+    }
+
+    [Test]
+    [TestCase(@"[A-Za-z_]\w*=")]
+    [TestCase(@"[0-9]+x")]
+    [TestCase(@"(?:foo|bar|[0-9])x")]
+    [TestCase(@"[^a-y]z")]
+    [TestCase(@"(?i)[k]b")]
+    [TestCase(@"[\x{e9}\x{20ac}]q")]
+    [TestCase(@"[\x{100}-\x{10ffff}]a")]
+    [TestCase(@"[\x{ff}]")]
+    [TestCase(@"(?:\x{e9}|\x{1f600})\d")]
+    public void should_search_start_bitmap_like_the_interpreter(string pattern)
+    {
+        var subjects = new[]
+        {
+            new string('b', 100) + "a_1=",
+            new string('.', 31) + "x" + new string('.', 40) + "a=b.c=d",
+            new string('b', 40) + "42x" + new string('b', 40) + "7x" + new string('b', 40),
+            new string('b', 50) + "\u00e9q" + new string('b', 50) + "\u20acq" + new string('b', 50) + "\u212ab",
+            new string('b', 50) + "\u0100a" + new string('b', 50) + "\U0001F6002" + new string('b', 50) + "\u00ff",
+            "\u00e95" + new string('b', 50) + "\nzz" + new string('b', 50)
+        };
+
+        // The first line limits the search without the vectorized scan, and the JIT of PCRE2 may report partial matches past it
+        foreach (var (options, matchOptions) in new[]
+                 {
+                     (PcreOptions.None, PcreMatchOptions.None),
+                     (PcreOptions.None, PcreMatchOptions.PartialSoft),
+                     (PcreOptions.FirstLine, PcreMatchOptions.None)
+                 })
+        {
+            var re = new PcreRegex(pattern, options | PcreOptions.Compiled | PcreOptions.CompiledPartial);
+            var reUtf8 = new PcreRegexUtf8(pattern, options | PcreOptions.Compiled | PcreOptions.CompiledPartial);
+
+            // Every match is searched, so the scan restarts after each start position which was tried
+            foreach (var subject in subjects)
+            {
+                var expected = re.Matches(subject, 0, matchOptions | PcreMatchOptions.NoJit, null, new PcreMatchSettings()).Select(m => (m.Index, m.Length)).ToList();
+                var matches = re.Matches(subject, 0, matchOptions, null, new PcreMatchSettings()).Select(m => (m.Index, m.Length)).ToList();
+
+                Assert.That(matches, Is.EqualTo(expected));
+
+                var utf8Subject = Encoding.UTF8.GetBytes(subject);
+                var expectedUtf8 = reUtf8.Match(utf8Subject, matchOptions | PcreMatchOptions.NoJit);
+                var matchUtf8 = reUtf8.Match(utf8Subject, matchOptions);
+
+                Assert.That(matchUtf8.Success, Is.EqualTo(expectedUtf8.Success));
+                Assert.That(matchUtf8.IsPartialMatch, Is.EqualTo(expectedUtf8.IsPartialMatch));
+                Assert.That(matchUtf8.Index, Is.EqualTo(expectedUtf8.Index));
+                Assert.That(matchUtf8.Length, Is.EqualTo(expectedUtf8.Length));
+            }
+        }
+    }
+
     [Test]
     public void readme_json_example()
     {
@@ -0,0 +1,127 @@
+﻿#if NET
+using System;
+using System.Collections.Generic;
+using System.Diagnostics.Metrics;
+using System.Linq;
+using NUnit.Framework;
+using PCRE.Internal;
+
+namespace PCRE.Tests.PcreNet;
+
+[TestFixture]
+[NonParallelizable]
+public class MetricsTests
+{
+    private MeterListener _listener = null!;
+    private List<(string name, double value, string? tag)> _measurements = null!;
+
+    [SetUp]
+    public void SetUp()
+    {
+        _measurements = [];
+
+        _listener = new MeterListener();
+        _listener.InstrumentPublished = (instrument, listener) =>
+        {
+            if (instrument.Meter.Name == Metrics.Name)
+                listener.EnableMeasurementEvents(instrument);
+        };
+
+        _listener.SetMeasurementEventCallback<long>((instrument, value, tags, _) => Record(instrument, value, tags));
+        _listener.SetMeasurementEventCallback<double>((instrument, value, tags, _) => Record(instrument, value, tags));
+        _listener.Start();
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        _listener.Dispose();
+    }
+
+    [Test]
+    public void should_record_compilations()
+    {
+        _ = new PcreRegex(Guid.NewGuid().ToString(), PcreOptions.Compiled);
+
+        Assert.That(GetValues("pcre.compile.count"), Is.EqualTo(new[] { 1.0 }));
+        Assert.That(GetValues("pcre.compile.duration"), Has.Exactly(1).GreaterThanOrEqualTo(0.0));
+        Assert.That(GetValues("pcre.jit.compile.duration"), Has.Exactly(1).GreaterThanOrEqualTo(0.0));
+        Assert.That(GetValues("pcre.jit.compile.failures"), Is.Empty);
+    }
+
+    [Test]
+    public void should_record_cache_lookups()
+    {
+        var pattern = Guid.NewGuid().ToString();
+
+        _ = new PcreRegex(pattern);
+        _ = new PcreRegex(pattern);
+
+        Assert.That(GetTags("pcre.cache.lookups"), Is.EqualTo(new[] { "miss", "hit" }));
+    }
+
+    [Test]
+    public void should_record_match_engines()
+    {
+        var re = new PcreRegex("fo+", PcreOptions.Compiled);
+        _measurements.Clear();
+
+        re.IsMatch("foo");
+        re.Match("foo", PcreMatchOptions.NoJit);
+        re.Dfa.Match("foo");
+
+        Assert.That(GetTags("pcre.match.count"), Is.EqualTo(new[] { "jit", "interpreter", "dfa" }));
+    }
+
+    [Test]
+    public void should_record_literal_matches()
+    {
+        var re = new PcreRegex("foo", PcreOptions.Compiled);
+        _measurements.Clear();
+
+        re.IsMatch("foo");
+        re.Match("foo", PcreMatchOptions.PartialSoft);
+
+        Assert.That(GetTags("pcre.match.count"), Is.EqualTo(new[] { "literal", "jit" }));
+    }
+
+    [Test]
+    public void should_record_match_limit_errors()
+    {
+        var re = new PcreRegex(@"(a+)+$");
+
+        Assert.Throws<PcreMatchException>(() => re.Match(new string('a', 30) + "b", 0, PcreMatchOptions.None, null, new PcreMatchSettings { MatchLimit = 100 }));
+
+        Assert.That(GetTags("pcre.match.errors"), Is.EqualTo(new[] { "match_limit" }));
+    }
+
+    [Test]
+    public void should_record_substitute_retries()
+    {
+        var re = new PcreRegex("a");
+        _measurements.Clear();
+
+        _ = re.Substitute(new string('a', InternalRegex.SubstituteBufferSizeInChars), "bb", PcreSubstituteOptions.SubstituteGlobal);
+
+        Assert.That(GetValues("pcre.substitute.retries"), Is.EqualTo(new[] { 1.0 }));
+    }
+
+    private void Record(Instrument instrument, double value, ReadOnlySpan<KeyValuePair<string, object?>> tags)
+    {
+        lock (_measurements)
+            _measurements.Add((instrument.Name, value, tags.Length != 0 ? tags[0].Value?.ToString() : null));
+    }
+
+    private double[] GetValues(string name)
+    {
+        lock (_measurements)
+            return _measurements.Where(i => i.name == name).Select(i => i.value).ToArray();
+    }
+
+    private string?[] GetTags(string name)
+    {
+        lock (_measurements)
+            return _measurements.Where(i => i.name == name).Select(i => i.tag).ToArray();
+    }
+}
+#endif
@@ -0,0 +1,102 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using NUnit.Framework;
+
+namespace PCRE.Tests.PcreNet;
+
+[TestFixture]
+public class PcreJitMemoryTests
+{
+#if CUSTOM_JIT_ALLOCATOR
+    [Test]
+    public void should_use_custom_allocator_on_linux()
+    {
+        // The custom allocator is enabled by the module initializer
+        Assert.That(PcreJitMemory.IsCustomAllocator, Is.EqualTo(RuntimeInformation.IsOSPlatform(OSPlatform.Linux)));
+    }
+#else
+    [Test]
+    public void should_use_default_allocator()
+    {
+        Assert.That(PcreJitMemory.IsCustomAllocator, Is.False);
+    }
+#endif
+
+    [Test]
+    public void should_keep_allocator_after_jit_compilation()
+    {
+        var regex = new PcreRegex(Guid.NewGuid().ToString("N") + @"\w+", PcreOptions.Compiled);
+        var isCustomAllocator = PcreJitMemory.IsCustomAllocator;
+
+        Assert.That(PcreJitMemory.TryEnableCustomAllocator(), Is.EqualTo(isCustomAllocator));
+        Assert.That(PcreJitMemory.IsCustomAllocator, Is.EqualTo(isCustomAllocator));
+
+        GC.KeepAlive(regex);
+    }
+
+    [Test]
+    public void should_report_allocated_jit_code()
+    {
+        if (!PcreJitMemory.IsCustomAllocator)
+            Assert.Ignore("The custom allocator is not used on this platform");
+
+        var regex = new PcreRegex(Guid.NewGuid().ToString("N") + @"\d+", PcreOptions.Compiled);
+        var stats = PcreJitMemory.GetStatistics();
+        Console.WriteLine(stats);
+
+        Assert.That(stats.AllocationCount, Is.GreaterThan(0));
+        Assert.That(stats.AllocatedBytes, Is.GreaterThan(0));
+        Assert.That(stats.RegionCount, Is.GreaterThan(0));
+        Assert.That(stats.ReservedBytes, Is.GreaterThanOrEqualTo(stats.AllocatedBytes));
+
+        GC.KeepAlive(regex);
+    }
+
+    [Test]
+    public void should_report_allocated_jit_code_with_any_allocator()
+    {
+        var regex = new PcreRegex(Guid.NewGuid().ToString("N") + @"[a-z]+", PcreOptions.Compiled);
+        var stats = PcreJitMemory.GetStatistics();
+
+        Assert.That(stats.AllocatedBytes, Is.GreaterThan(0));
+        Assert.That(stats.ReservedBytes, Is.GreaterThanOrEqualTo(stats.AllocatedBytes));
+
+        GC.KeepAlive(regex);
+    }
+
+    [Test]
+    public void should_trim_unused_memory()
+    {
+        var prefix = Guid.NewGuid().ToString("N");
+        var regex = new PcreRegex(prefix + @"\s+", PcreOptions.Compiled);
+
+        PcreJitMemory.Trim();
+
+        Assert.That(PcreJitMemory.GetStatistics().AllocatedBytes, Is.GreaterThan(0));
+        Assert.That(regex.IsMatch(prefix + " "), Is.True);
+    }
+
+    [Test]
+    [NonParallelizable]
+    public void should_toggle_huge_pages()
+    {
+        if (!PcreJitMemory.IsCustomAllocator)
+            Assert.Ignore("The custom allocator is not used on this platform");
+
+        try
+        {
+            PcreJitMemory.UseHugePages = true;
+            Assert.That(PcreJitMemory.UseHugePages, Is.True);
+
+            var prefix = Guid.NewGuid().ToString("N");
+            var regex = new PcreRegex(prefix + @"-\w+", PcreOptions.Compiled);
+            Assert.That(regex.IsMatch(prefix + "-abc"), Is.True);
+        }
+        finally
+        {
+            PcreJitMemory.UseHugePages = false;
+        }
+
+        Assert.That(PcreJitMemory.UseHugePages, Is.False);
+    }
+}
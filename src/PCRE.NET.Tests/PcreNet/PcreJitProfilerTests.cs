@@ -0,0 +1,90 @@
+﻿using System;
+using System.Diagnostics;
+using System.IO;
+using System.Runtime.InteropServices;
+using NUnit.Framework;
+
+namespace PCRE.Tests.PcreNet;
+
+[TestFixture]
+[NonParallelizable]
+public class PcreJitProfilerTests
+{
+    [TearDown]
+    public void TearDown()
+    {
+        PcreJitProfiler.PerfMapEnabled = false;
+        PcreJitProfiler.GdbJitInterfaceEnabled = false;
+    }
+
+    [Test]
+    public void should_be_supported_on_linux()
+    {
+        Assert.That(PcreJitProfiler.IsSupported, Is.EqualTo(RuntimeInformation.IsOSPlatform(OSPlatform.Linux)));
+    }
+
+    [Test]
+    public void should_not_enable_unsupported_modes()
+    {
+        if (PcreJitProfiler.IsSupported)
+            Assert.Ignore("JIT profiling is supported on this platform");
+
+        PcreJitProfiler.PerfMapEnabled = true;
+        PcreJitProfiler.GdbJitInterfaceEnabled = true;
+
+        Assert.That(PcreJitProfiler.PerfMapEnabled, Is.False);
+        Assert.That(PcreJitProfiler.GdbJitInterfaceEnabled, Is.False);
+    }
+
+    [Test]
+    public void should_write_perf_map()
+    {
+        if (!PcreJitProfiler.IsSupported)
+            Assert.Ignore("JIT profiling is not supported on this platform");
+
+        PcreJitProfiler.PerfMapEnabled = true;
+        Assert.That(PcreJitProfiler.PerfMapEnabled, Is.True);
+
+        var pattern = "perf-" + Guid.NewGuid().ToString("N") + @"\d+";
+        var regex = new PcreRegex(pattern, PcreOptions.Compiled);
+
+        var perfMap = File.ReadAllText($"/tmp/perf-{GetProcessId()}.map");
+        Assert.That(perfMap, Does.Contain(":" + pattern + "\n"));
+
+        GC.KeepAlive(regex);
+    }
+
+    [Test]
+    public void should_register_with_gdb()
+    {
+        if (!PcreJitProfiler.IsSupported)
+            Assert.Ignore("JIT profiling is not supported on this platform");
+
+        PcreJitProfiler.GdbJitInterfaceEnabled = true;
+        Assert.That(PcreJitProfiler.GdbJitInterfaceEnabled, Is.True);
+
+        CompileAndMatch();
+
+        PcreJitProfiler.GdbJitInterfaceEnabled = false;
+
+        // The code is unregistered when it is freed
+        GC.Collect();
+        GC.WaitForPendingFinalizers();
+
+        static void CompileAndMatch()
+        {
+            var regex = new PcreRegexUtf8("gdb-" + Guid.NewGuid().ToString("N") + @"-\d+", PcreOptions.Compiled);
+            Assert.That(regex.IsMatch("gdb-42"u8), Is.False);
+        }
+    }
+
+    private static int GetProcessId()
+    {
+#if NET
+        return Environment.ProcessId;
+#else
+        using var process = Process.GetCurrentProcess();
+        return process.Id;
+#endif
+    }
+}
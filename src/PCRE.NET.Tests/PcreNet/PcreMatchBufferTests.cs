@@ -1,7 +1,11 @@
 ﻿using System;
+using System.Globalization;
+using System.Linq;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
 using NUnit.Framework;
 using PCRE.Internal;
 using PCRE.Tests.Support;
@@ -55,6 +59,55 @@ public unsafe class PcreMatchBufferTests
         Assert.That(Unsafe.AreSame(ref MemoryMarshal.GetReference(match.OutputVector), ref buffer.OutputVector[0]), Is.True);
     }
 
+    [Test]
+    [TestCase("foo", PcreOptions.None)]
+    [TestCase("(?i)foo", PcreOptions.None)]
+    [TestCase(@"\d{3}-\d{4}", PcreOptions.None)]
+    [TestCase(@"\d{3}-\d{4}", PcreOptions.Compiled)]
+    [TestCase(@"(?i)error: \w+", PcreOptions.None)]
+    public void should_match_like_pcre_without_calling_native_code(string pattern, PcreOptions options)
+    {
+        var re = new PcreRegex(pattern, options);
+        var buffer = re.CreateMatchBuffer();
+
+        // A heap limit disables the literal match and the prefilter
+        var nativeBuffer = re.CreateMatchBuffer(new PcreMatchSettings { HeapLimit = 1000000 });
+
+        foreach (var subject in new[] { "", "fo", "xfoofOOFoo", "call 555-1234 now", "ERROR: disk full", "\u00e9foo 555-1234" })
+        {
+            for (var startIndex = 0; startIndex <= subject.Length; ++startIndex)
+            {
+                var match = buffer.Match(subject.AsSpan(), startIndex);
+                var expected = nativeBuffer.Match(subject.AsSpan(), startIndex);
+
+                Assert.That(match.Success, Is.EqualTo(expected.Success));
+                Assert.That(match.Index, Is.EqualTo(expected.Index));
+                Assert.That(match.Length, Is.EqualTo(expected.Length));
+            }
+
+            var matchCount = 0;
+            foreach (var match in buffer.Matches(subject.AsSpan()))
+            {
+                Assert.That(match.Index, Is.EqualTo(re.Match(subject, match.Index).Index));
+                ++matchCount;
+            }
+
+            Assert.That(matchCount, Is.EqualTo(re.Matches(subject).Count()));
+        }
+    }
+
+    [Test]
+    public void should_match_like_pcre_without_calling_native_code_utf8()
+    {
+        var literal = new PcreRegexUtf8("(?i)NEEDLE"u8).CreateMatchBuffer();
+        Assert.That(literal.Match("hay \u00e9 needle"u8).Index, Is.EqualTo(7));
+        Assert.That(literal.IsMatch("hay"u8), Is.False);
+
+        var prefiltered = new PcreRegexUtf8(@"\d{3}-\d{4}"u8, PcreOptions.Compiled).CreateMatchBuffer();
+        Assert.That(prefiltered.IsMatch("hello world"u8), Is.False);
+        Assert.That(prefiltered.Match("caf\u00e9 555-1234"u8).Index, Is.EqualTo(6));
+    }
+
     [Test]
     public void should_use_callout_buffer()
     {
@@ -93,6 +146,325 @@ public unsafe class PcreMatchBufferTests
         Assert.That(match.Success, Is.True);
     }
 
+    [Test]
+    public void should_not_collect_statistics_by_default()
+    {
+        var buffer = new PcreRegex("foo").CreateMatchBuffer();
+
+        _ = buffer.Match("foo".AsSpan());
+
+        Assert.That(buffer.Statistics, Is.Null);
+    }
+
+    [Test]
+    public void should_collect_statistics()
+    {
+        var re = new PcreRegex(@"a+b", PcreOptions.Compiled);
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectStatistics = true });
+
+        var match = buffer.Match("xxxxaaab".AsSpan());
+        var stats = buffer.Statistics.GetValueOrDefault();
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(stats.StepCount, Is.EqualTo(3));
+        Assert.That(stats.BacktrackCount, Is.EqualTo(0));
+        Assert.That(stats.StartPositionCount, Is.EqualTo(1));
+        Assert.That(stats.SkippedLength, Is.EqualTo(4));
+        Assert.That(stats.HeapFramesSize, Is.GreaterThan(0));
+    }
+
+    [Test]
+    public void should_collect_backtracking_statistics()
+    {
+        var re = new PcreRegex(@"(a|b|ab)*$");
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectStatistics = true });
+
+        _ = buffer.Match("ababababx".AsSpan());
+        var stats = buffer.Statistics.GetValueOrDefault();
+
+        Assert.That(stats.BacktrackCount, Is.GreaterThan(0));
+        Assert.That(stats.StartPositionCount + stats.SkippedLength, Is.EqualTo(10));
+    }
+
+    [Test]
+    public void should_collect_interpreter_statistics_for_compiled_patterns()
+    {
+        var settings = new PcreMatchSettings { CollectStatistics = true };
+        var buffer = new PcreRegex(@"(a|b|ab)*$").CreateMatchBuffer(settings);
+        var compiledBuffer = new PcreRegex(@"(a|b|ab)*$", PcreOptions.Compiled).CreateMatchBuffer(settings);
+
+        _ = buffer.Match("ababababx".AsSpan());
+        _ = compiledBuffer.Match("ababababx".AsSpan());
+
+        Assert.That(compiledBuffer.Statistics, Is.EqualTo(buffer.Statistics));
+    }
+
+    [Test]
+    public void should_reset_statistics_between_matches()
+    {
+        var re = new PcreRegex(@"a+b");
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectStatistics = true });
+
+        _ = buffer.Match("aaab".AsSpan());
+        var match = buffer.Match("xxxxxxx".AsSpan());
+        var stats = buffer.Statistics.GetValueOrDefault();
+
+        Assert.That(match.Success, Is.False);
+        Assert.That(stats.StepCount, Is.EqualTo(0));
+        Assert.That(stats.StartPositionCount, Is.EqualTo(0));
+        Assert.That(stats.SkippedLength, Is.EqualTo(8));
+    }
+
+    [Test]
+    public void should_collect_statistics_utf8()
+    {
+        var re = new PcreRegexUtf8("a+b"u8);
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectStatistics = true });
+
+        var match = buffer.Match("xxab"u8);
+        var stats = buffer.Statistics.GetValueOrDefault();
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(stats.StartPositionCount, Is.EqualTo(1));
+        Assert.That(stats.SkippedLength, Is.EqualTo(2));
+    }
+
+    [Test]
+    public void should_pass_callouts_when_collecting_statistics()
+    {
+        var re = new PcreRegex(@"a(?C1)b");
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectStatistics = true });
+        var calls = 0;
+
+        var match = buffer.Match("ab".AsSpan(), data =>
+        {
+            Assert.That(data.Number, Is.EqualTo(1));
+            ++calls;
+            return PcreCalloutResult.Pass;
+        });
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(calls, Is.EqualTo(1));
+    }
+
+    [Test]
+    public void should_throw_on_statistics_of_disposed_buffer()
+    {
+        var buffer = new PcreRegex("foo").CreateMatchBuffer(new PcreMatchSettings { CollectStatistics = true });
+        buffer.Dispose();
+
+        Assert.Throws<ObjectDisposedException>(() => _ = buffer.Statistics);
+    }
+
+    [Test]
+    public void should_not_collect_profile_by_default()
+    {
+        var buffer = new PcreRegex("foo").CreateMatchBuffer();
+
+        _ = buffer.Match("foo".AsSpan());
+
+        Assert.That(buffer.GetProfile(), Is.Null);
+    }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_collect_profile(PcreOptions options)
+    {
+        var re = new PcreRegex(@"(a|b|ab)*c", options);
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectProfile = true });
+
+        for (var i = 0; i < 10; ++i)
+            Assert.That(buffer.Match("abababc".AsSpan()).Success, Is.True);
+
+        var profile = buffer.GetProfile()!;
+
+        Assert.That(profile.Entries.Select(i => i.PatternPosition), Is.EqualTo(new[] { 0, 1, 2, 3, 4, 5, 9, 10 }));
+        Assert.That(profile.Entries.Select(i => i.HitCount), Is.EqualTo(new long[] { 10, 70, 30, 40, 30, 10, 10, 10 }));
+        Assert.That(profile.Entries[profile.Entries.Count - 1].NextPatternItemLength, Is.EqualTo(0));
+        Assert.That(profile.TotalHitCount, Is.EqualTo(210));
+        Assert.That(profile.Entries.Sum(i => i.SampleCount), Is.GreaterThan(0));
+    }
+
+    [Test]
+    public void should_reset_profile()
+    {
+        var re = new PcreRegex(@"a+b");
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectProfile = true });
+
+        _ = buffer.Match("aab".AsSpan());
+        buffer.ResetProfile();
+
+        Assert.That(buffer.GetProfile()!.Entries, Is.Empty);
+
+        _ = buffer.Match("aab".AsSpan());
+
+        Assert.That(buffer.GetProfile()!.TotalHitCount, Is.EqualTo(3));
+    }
+
+    [Test]
+    public void should_collect_profile_utf8()
+    {
+        var re = new PcreRegexUtf8("é+b"u8);
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectProfile = true });
+
+        _ = buffer.Match("éb"u8);
+
+        Assert.That(buffer.GetProfile()!.Entries.Select(i => i.PatternPosition), Is.EqualTo(new[] { 0, 3, 4 }));
+    }
+
+    [Test]
+    public void should_not_profile_explicit_callout_255()
+    {
+        var re = new PcreRegex(@"a(?C255)b");
+        var buffer = re.CreateMatchBuffer(new PcreMatchSettings { CollectProfile = true });
+        var calls = 0;
+
+        var match = buffer.Match("ab".AsSpan(), _ =>
+        {
+            ++calls;
+            return PcreCalloutResult.Pass;
+        });
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(calls, Is.EqualTo(1));
+        Assert.That(buffer.GetProfile()!.Entries, Is.Empty);
+    }
+
+    [Test]
+    public void should_reuse_rented_buffers()
+    {
+        var re = new PcreRegex("foo");
+        var reused = false;
+
+        // The slot depends on the current processor, which may change between calls
+        for (var i = 0; i < 10 && !reused; ++i)
+        {
+            var buffer = re.RentMatchBuffer();
+            re.ReturnMatchBuffer(buffer);
+
+            var rentedBuffer = re.RentMatchBuffer();
+            reused = ReferenceEquals(rentedBuffer, buffer);
+            re.ReturnMatchBuffer(rentedBuffer);
+        }
+
+        Assert.That(reused, Is.True);
+    }
+
+    [Test]
+    public void should_share_rented_buffers_between_instances()
+    {
+        var pattern = Guid.NewGuid().ToString();
+        var buffer = new PcreRegex(pattern).RentMatchBuffer();
+
+        Assert.DoesNotThrow(() => new PcreRegex(pattern).ReturnMatchBuffer(buffer));
+    }
+
+    [Test]
+    public void should_match_with_rented_buffer()
+    {
+        var re = new PcreRegex(@"a(?<b>b)c");
+        var buffer = re.RentMatchBuffer();
+
+        var match = buffer.Match("xabc".AsSpan());
+
+        Assert.That(match.Success, Is.True);
+        Assert.That(match.Index, Is.EqualTo(1));
+        Assert.That(match.Groups["b"].Value.ToString(), Is.EqualTo("b"));
+
+        re.ReturnMatchBuffer(buffer);
+    }
+
+    [Test]
+    public void should_match_with_rented_buffer_utf8()
+    {
+        var re = new PcreRegexUtf8("é+"u8);
+        var buffer = re.RentMatchBuffer();
+
+        Assert.That(buffer.Match("xéé"u8).Index, Is.EqualTo(1));
+
+        re.ReturnMatchBuffer(buffer);
+    }
+
+    [Test]
+    public void should_throw_when_returning_a_buffer_which_was_not_rented()
+    {
+        var re = new PcreRegex("foo");
+
+        Assert.Throws<ArgumentNullException>(() => re.ReturnMatchBuffer(null!));
+        Assert.Throws<ArgumentException>(() => re.ReturnMatchBuffer(re.CreateMatchBuffer()));
+        Assert.Throws<ArgumentException>(() => re.ReturnMatchBuffer(new PcreRegex("bar").RentMatchBuffer()));
+    }
+
+    [Test]
+    public void should_throw_when_returning_a_buffer_twice()
+    {
+        var re = new PcreRegex(Guid.NewGuid().ToString());
+        var buffer = re.RentMatchBuffer();
+
+        re.ReturnMatchBuffer(buffer);
+
+        Assert.Throws<InvalidOperationException>(() => re.ReturnMatchBuffer(buffer));
+        Assert.Throws<InvalidOperationException>(() => buffer.IsMatch("foo".AsSpan()));
+
+        var rentedBuffers = Enumerable.Range(0, 10).Select(_ => re.RentMatchBuffer()).ToList();
+        Assert.That(rentedBuffers.Distinct().Count(), Is.EqualTo(rentedBuffers.Count));
+
+        foreach (var rentedBuffer in rentedBuffers)
+            re.ReturnMatchBuffer(rentedBuffer);
+    }
+
+    [Test]
+    public void should_throw_when_returning_a_buffer_twice_utf8()
+    {
+        var re = new PcreRegexUtf8("foo"u8);
+        var buffer = re.RentMatchBuffer();
+
+        re.ReturnMatchBuffer(buffer);
+
+        Assert.Throws<InvalidOperationException>(() => re.ReturnMatchBuffer(buffer));
+    }
+
+    [Test]
+    public void should_not_reuse_disposed_buffers()
+    {
+        var re = new PcreRegex(Guid.NewGuid().ToString());
+        var buffer = re.RentMatchBuffer();
+        buffer.Dispose();
+
+        re.ReturnMatchBuffer(buffer);
+
+        for (var i = 0; i < 10; ++i)
+            Assert.That(re.RentMatchBuffer(), Is.Not.SameAs(buffer));
+    }
+
+    [Test]
+    public void should_rent_buffers_concurrently()
+    {
+        var re = new PcreRegex(@"\d+", PcreOptions.Compiled);
+        var matchCount = 0;
+
+        Parallel.For(0, 10000, i =>
+        {
+            var buffer = re.RentMatchBuffer();
+
+            try
+            {
+                var subject = $"item {i}";
+                var match = buffer.Match(subject.AsSpan());
+
+                if (match.Success && match.Value.ToString() == i.ToString(CultureInfo.InvariantCulture))
+                    Interlocked.Increment(ref matchCount);
+            }
+            finally
+            {
+                re.ReturnMatchBuffer(buffer);
+            }
+        });
+
+        Assert.That(matchCount, Is.EqualTo(10000));
+    }
+
 #if NET
 
     [Test]
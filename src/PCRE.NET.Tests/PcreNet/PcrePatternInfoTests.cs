@@ -1,4 +1,6 @@
-﻿using System.Text;
+﻿using System;
+using System.Runtime.CompilerServices;
+using System.Text;
 using NUnit.Framework;
 using PCRE.Tests.Support;
 
@@ -66,6 +68,74 @@ public class PcrePatternInfoTests
         Assert.That(re.PatternInfo.CaptureCount, Is.EqualTo(expected));
     }
 
+    [Test]
+    public void should_share_compiled_pattern_between_instances()
+    {
+        var pattern = $"shared-{Guid.NewGuid():N}";
+        var first = new PcreRegex(pattern, PcreOptions.Compiled);
+
+        // Evict the pattern from the cache
+        for (var i = 0; i < PcreRegex.CacheSize + 1; ++i)
+            _ = new PcreRegex($"{pattern}-{i}");
+
+        var second = new PcreRegex(pattern, PcreOptions.Compiled);
+        var other = new PcreRegex(pattern, PcreOptions.Compiled | PcreOptions.IgnoreCase);
+
+        Assert.That(second.InternalRegex, Is.SameAs(first.InternalRegex));
+        Assert.That(other.InternalRegex, Is.Not.SameAs(first.InternalRegex));
+
+        Assert.That(first.PatternInfo.InstanceCount, Is.EqualTo(2));
+        Assert.That(second.PatternInfo.InstanceCount, Is.EqualTo(2));
+        Assert.That(other.PatternInfo.InstanceCount, Is.EqualTo(1));
+    }
+
+    [Test]
+    public void should_only_count_live_instances()
+    {
+        var pattern = $"live-{Guid.NewGuid():N}";
+        var regex = new PcreRegex(pattern);
+
+        CreateInstances(pattern, 10);
+        Assert.That(regex.PatternInfo.InstanceCount, Is.GreaterThan(1));
+
+        GC.Collect();
+
+        Assert.That(regex.PatternInfo.InstanceCount, Is.EqualTo(1));
+
+        CreateInstances(pattern, 10);
+        GC.Collect();
+
+        Assert.That(regex.PatternInfo.InstanceCount, Is.EqualTo(1));
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static void CreateInstances(string pattern, int count)
+        {
+            for (var i = 0; i < count; ++i)
+                _ = new PcreRegex(pattern);
+        }
+    }
+
+    [Test]
+    public void should_not_count_static_helper_instances()
+    {
+        var pattern = $"static-{Guid.NewGuid():N}";
+        var regex = new PcreRegex(pattern);
+
+        Assert.That(PcreRegex.IsMatch(pattern, pattern), Is.True);
+        Assert.That(PcreRegex.Match(pattern, pattern).Success, Is.True);
+        Assert.That(regex.PatternInfo.InstanceCount, Is.EqualTo(1));
+    }
+
+    [Test]
+    public void should_not_share_compiled_pattern_utf8()
+    {
+        var first = new PcreRegexUtf8(@"foo\s+bar"u8);
+        var second = new PcreRegexUtf8(@"foo\s+bar"u8);
+
+        Assert.That(first.PatternInfo.InstanceCount, Is.EqualTo(1));
+        Assert.That(second.PatternInfo.InstanceCount, Is.EqualTo(1));
+    }
+
     [Test]
     [TestCase(@"a", new string[0])]
     [TestCase(@"(a)", new string[0])]
@@ -0,0 +1,160 @@
+﻿using System;
+using System.IO;
+using System.Linq;
+using NUnit.Framework;
+using PCRE.Internal;
+
+namespace PCRE.Tests.PcreNet;
+
+[TestFixture]
+[NonParallelizable]
+public class PcrePersistentCacheTests
+{
+    private string _directory = null!;
+
+    [SetUp]
+    public void SetUp()
+    {
+        _directory = Path.Combine(Path.GetTempPath(), "PCRE.NET.Tests", Guid.NewGuid().ToString("N"));
+        PcrePersistentCache.Directory = _directory;
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        PcrePersistentCache.Directory = null;
+
+        if (Directory.Exists(_directory))
+            Directory.Delete(_directory, true);
+    }
+
+    [Test]
+    public void should_load_patterns_from_cache()
+    {
+        var hitCount = PcrePersistentCache.HitCount;
+        var missCount = PcrePersistentCache.MissCount;
+
+        _ = new PcreRegexUtf8(@"(?<word>\w+)-(\d+)"u8, PcreOptions.Compiled);
+
+        Assert.That(PcrePersistentCache.MissCount, Is.EqualTo(missCount + 1));
+        Assert.That(PcrePersistentCache.HitCount, Is.EqualTo(hitCount));
+
+        var re = new PcreRegexUtf8(@"(?<word>\w+)-(\d+)"u8, PcreOptions.Compiled);
+
+        Assert.That(PcrePersistentCache.MissCount, Is.EqualTo(missCount + 1));
+        Assert.That(PcrePersistentCache.HitCount, Is.EqualTo(hitCount + 1));
+
+        var match = re.Match("foo abc-42"u8);
+        Assert.That(match.Success, Is.True);
+        Assert.That(match["word"].Value.ToArray(), Is.EqualTo("abc"u8.ToArray()));
+        Assert.That(match[2].Value.ToArray(), Is.EqualTo("42"u8.ToArray()));
+    }
+
+    [Test]
+    public void should_not_share_entries_between_settings()
+    {
+        var missCount = PcrePersistentCache.MissCount;
+
+        _ = new PcreRegexUtf8(@"foo\d+"u8);
+        var re = new PcreRegexUtf8(@"foo\d+"u8, PcreOptions.IgnoreCase);
+
+        Assert.That(PcrePersistentCache.MissCount, Is.EqualTo(missCount + 2));
+        Assert.That(re.IsMatch("FOO42"u8), Is.True);
+    }
+
+    [Test]
+    public void should_write_utf16_patterns()
+    {
+        _ = new PcreRegex(Guid.NewGuid().ToString("N") + @"\d+");
+
+        Assert.That(Directory.GetFiles(_directory), Has.Length.EqualTo(1));
+    }
+
+    [Test]
+    public void should_ignore_corrupted_entries()
+    {
+        _ = new PcreRegexUtf8(@"foo(\d+)"u8, PcreOptions.Compiled);
+
+        foreach (var path in Directory.GetFiles(_directory))
+        {
+            var bytes = File.ReadAllBytes(path);
+            bytes[bytes.Length / 2] ^= 0x55;
+            File.WriteAllBytes(path, bytes);
+        }
+
+        var hitCount = PcrePersistentCache.HitCount;
+        var missCount = PcrePersistentCache.MissCount;
+
+        var re = new PcreRegexUtf8(@"foo(\d+)"u8, PcreOptions.Compiled);
+
+        Assert.That(PcrePersistentCache.MissCount, Is.EqualTo(missCount + 1));
+        Assert.That(PcrePersistentCache.HitCount, Is.EqualTo(hitCount));
+        Assert.That(re.Match("foo42"u8)[1].Value.ToArray(), Is.EqualTo("42"u8.ToArray()));
+
+        _ = new PcreRegexUtf8(@"foo(\d+)"u8, PcreOptions.Compiled);
+        Assert.That(PcrePersistentCache.HitCount, Is.EqualTo(hitCount + 1));
+    }
+
+    [Test]
+    public void should_replace_corrupted_entries_in_place()
+    {
+        _ = new PcreRegexUtf8(@"bar(\d+)"u8);
+
+        var path = Directory.GetFiles(_directory).Single();
+        File.WriteAllBytes(path, new byte[16]);
+
+        _ = new PcreRegexUtf8(@"bar(\d+)"u8);
+
+        Assert.That(Directory.GetFiles(_directory), Is.EqualTo(new[] { path }));
+        Assert.That(new FileInfo(path).Length, Is.GreaterThan(16));
+    }
+
+    [Test]
+    public void should_load_precompiled_patterns()
+    {
+        _ = new PcreRegexUtf8(@"foo(\d+)bar"u8, PcreOptions.Compiled);
+
+        var path = Directory.GetFiles(_directory).Single();
+        var bytes = File.ReadAllBytes(path);
+
+        PcrePersistentCache.Directory = null;
+        PersistentCache.AddPrecompiledEntry(Path.GetFileName(path), () => new MemoryStream(bytes));
+
+        try
+        {
+            var hitCount = PcrePersistentCache.HitCount;
+            var re = new PcreRegexUtf8(@"foo(\d+)bar"u8, PcreOptions.Compiled);
+
+            Assert.That(PcrePersistentCache.HitCount, Is.EqualTo(hitCount + 1));
+            Assert.That(re.Match("foo42bar"u8)[1].Value.ToArray(), Is.EqualTo("42"u8.ToArray()));
+
+            _ = new PcreRegexUtf8(@"foo(\d+)baz"u8, PcreOptions.Compiled);
+            Assert.That(PcrePersistentCache.HitCount, Is.EqualTo(hitCount + 1));
+        }
+        finally
+        {
+            PersistentCache.ClearPrecompiledEntries();
+        }
+    }
+
+    [Test]
+    public void should_ignore_missing_precompiled_patterns()
+    {
+        PcrePersistentCache.AddPrecompiledPatterns(typeof(PcrePersistentCacheTests).Assembly);
+
+        var hitCount = PcrePersistentCache.HitCount;
+        _ = new PcreRegexUtf8(@"foo\d+"u8);
+
+        Assert.That(PcrePersistentCache.HitCount, Is.EqualTo(hitCount));
+    }
+
+    [Test]
+    public void should_clear_cache()
+    {
+        _ = new PcreRegexUtf8(@"foo\d+"u8);
+        Assert.That(Directory.GetFiles(_directory), Is.Not.Empty);
+
+        PcrePersistentCache.Clear();
+        Assert.That(Directory.GetFiles(_directory), Is.Empty);
+    }
+}
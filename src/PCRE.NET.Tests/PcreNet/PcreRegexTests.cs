@@ -131,6 +131,60 @@ public class PcreRegexTests
         return true;
     }
 
+    [Test]
+    [TestCase("", ExpectedResult = -1)]
+    [TestCase("foo", ExpectedResult = -1)]
+    [TestCase("foo\uD83D\uDE00bar", ExpectedResult = -1)]
+    [TestCase("foo\uD83Dbar", ExpectedResult = 3)]
+    [TestCase("foo\uDE00bar", ExpectedResult = 3)]
+    [TestCase("foo\uD83D", ExpectedResult = 3)]
+    public int should_validate_utf(string subject)
+    {
+        var isValid = PcreRegex.IsValidUtf(subject.AsSpan(), out var errorOffset);
+        Assert.That(isValid, Is.EqualTo(errorOffset < 0));
+        Assert.That(PcreRegex.IsValidUtf(subject.AsSpan()), Is.EqualTo(isValid));
+        return errorOffset;
+    }
+
+    [Test]
+    [TestCase(new byte[0], ExpectedResult = -1)]
+    [TestCase(new byte[] { 0x66, 0x6F, 0x6F }, ExpectedResult = -1)]
+    [TestCase(new byte[] { 0x66, 0xC3, 0xA9, 0xF0, 0x9F, 0x98, 0x80, 0x66 }, ExpectedResult = -1)]
+    [TestCase(new byte[] { 0x66, 0x6F, 0x6F, 0xA9 }, ExpectedResult = 3)]
+    [TestCase(new byte[] { 0x66, 0xC3, 0x66 }, ExpectedResult = 1)]
+    [TestCase(new byte[] { 0x66, 0xC0, 0x80 }, ExpectedResult = 1)]
+    [TestCase(new byte[] { 0x66, 0xED, 0xA0, 0x80 }, ExpectedResult = 1)]
+    public int should_validate_utf_utf8(byte[] subject)
+    {
+        var isValid = PcreRegexUtf8.IsValidUtf(subject, out var errorOffset);
+        Assert.That(isValid, Is.EqualTo(errorOffset < 0));
+        Assert.That(PcreRegexUtf8.IsValidUtf(subject), Is.EqualTo(isValid));
+        return errorOffset;
+    }
+
+    [Test]
+    public void should_validate_utf_in_long_subject()
+    {
+        var subject = new string('x', 1000).ToCharArray();
+        Assert.That(PcreRegex.IsValidUtf(subject, out _), Is.True);
+
+        subject[517] = '\uDE00';
+        Assert.That(PcreRegex.IsValidUtf(subject, out var errorOffset), Is.False);
+        Assert.That(errorOffset, Is.EqualTo(517));
+    }
+
+    [Test]
+    public void should_validate_utf_in_long_subject_utf8()
+    {
+        var subject = new byte[1000];
+        subject.AsSpan().Fill((byte)'x');
+        Assert.That(PcreRegexUtf8.IsValidUtf(subject, out _), Is.True);
+
+        subject[517] = 0xFF;
+        Assert.That(PcreRegexUtf8.IsValidUtf(subject, out var errorOffset), Is.False);
+        Assert.That(errorOffset, Is.EqualTo(517));
+    }
+
     private static PcreRegex? TryCompilePattern(string pattern, PcreRegexSettings settings)
     {
         try
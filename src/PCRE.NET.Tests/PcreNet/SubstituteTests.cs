@@ -488,4 +488,22 @@ public class SubstituteTests
         var result = PcreRegex.Substitute("hello, world!!!", @"\p{P}+", "<$0>", PcreOptions.None, PcreSubstituteOptions.SubstituteGlobal);
         Assert.That(result, Is.EqualTo("hello<,> world<!!!>"));
     }
+
+    [Test]
+    [TestCase(PcreOptions.None)]
+    [TestCase(PcreOptions.Compiled)]
+    public void should_handle_match_timeout(PcreOptions options)
+    {
+        var re = new PcreRegex(@"(a|aa)+$", options);
+
+        var settings = new PcreMatchSettings
+        {
+            MatchLimit = uint.MaxValue,
+            Timeout = TimeSpan.FromMilliseconds(50)
+        };
+
+        Assert.Throws<PcreMatchTimeoutException>(() => re.Substitute(new string('a', 40) + "b", "x", 0, PcreSubstituteOptions.None, null, null, null, settings));
+        Assert.Throws<PcreMatchTimeoutException>(() => re.Substitute(new string('a', 40) + "b", "x", 0, PcreSubstituteOptions.None, _ => PcreCalloutResult.Pass, null, null, settings));
+        Assert.That(re.Substitute("aaa", "x", 0, PcreSubstituteOptions.None, null, null, null, settings), Is.EqualTo("x"));
+    }
 }
@@ -0,0 +1,75 @@
+﻿using System;
+using System.Runtime.CompilerServices;
+using NUnit.Framework;
+using PCRE.Internal;
+
+namespace PCRE.Tests.PcreNet.Support;
+
+[TestFixture]
+public class InternTableTests
+{
+    private InternTable<int, object> _table = default!;
+    private int _createdCount;
+
+    [SetUp]
+    public void Setup()
+    {
+        _createdCount = 0;
+        _table = new InternTable<int, object>(_ =>
+        {
+            ++_createdCount;
+            return new object();
+        });
+    }
+
+    [Test]
+    public void should_share_live_values()
+    {
+        var a = _table.GetOrAdd(1);
+        var b = _table.GetOrAdd(1);
+        var c = _table.GetOrAdd(2);
+
+        Assert.That(b, Is.SameAs(a));
+        Assert.That(c, Is.Not.SameAs(a));
+        Assert.That(_createdCount, Is.EqualTo(2));
+        Assert.That(_table.Count, Is.EqualTo(2));
+
+        GC.KeepAlive(a);
+        GC.KeepAlive(c);
+    }
+
+    [Test]
+    public void should_not_keep_values_alive()
+    {
+        var reference = AddAndForget(_table, 1);
+
+        GC.Collect();
+        GC.WaitForPendingFinalizers();
+        GC.Collect();
+
+        Assert.That(reference.IsAlive, Is.False);
+        Assert.That(_table.Count, Is.EqualTo(0));
+
+        _table.GetOrAdd(1);
+        Assert.That(_createdCount, Is.EqualTo(2));
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static WeakReference AddAndForget(InternTable<int, object> table, int key)
+            => new(table.GetOrAdd(key));
+    }
+
+    [Test]
+    public void should_prune_dead_values()
+    {
+        for (var i = 0; i < 1000; ++i)
+            _table.GetOrAdd(i);
+
+        GC.Collect();
+        GC.WaitForPendingFinalizers();
+
+        var value = _table.GetOrAdd(-1);
+
+        Assert.That(_table.Count, Is.LessThan(1000));
+        Assert.That(_table.GetOrAdd(-1), Is.SameAs(value));
+    }
+}
@@ -0,0 +1,384 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+
+namespace PCRE.Conversion;
+
+/// <summary>
+/// A set of glob patterns which are matched together against paths.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Simple globs are matched through hash tables, without running the regex engine: literal paths, <c>*.ext</c> and <c>**/*.ext</c> suffixes, <c>prefix/**</c> directories and <c>**</c>.
+/// </para>
+/// <para>
+/// The other globs are converted with <see cref="PcreConvert.FromGlob"/> and combined into a few compiled patterns, so a path is matched against a whole group of globs in a single operation which reports each glob that matched.
+/// </para>
+/// <para>
+/// Instances of this class are thread-safe.
+/// </para>
+/// </remarks>
+public sealed class PcreGlobSet
+{
+    // The compiled code size of a pattern is limited, so the combined patterns are split into chunks.
+    private const int _maxChunkGlobCount = 64;
+    private const int _maxChunkPatternLength = 8192;
+
+    private readonly string[] _globs;
+    private readonly char _separator;
+
+    private readonly Dictionary<int, List<SimpleGlob>> _literals = new();
+    private readonly Dictionary<int, List<SimpleGlob>> _suffixes = new();
+    private readonly Dictionary<int, List<SimpleGlob>> _prefixes = new();
+    private readonly List<int> _matchAll = new();
+    private readonly List<RegexChunk> _chunks = new();
+
+    /// <summary>
+    /// Creates a glob set using the default conversion options for the current platform.
+    /// </summary>
+    /// <param name="globs">The glob patterns.</param>
+    public PcreGlobSet(IEnumerable<string> globs)
+        : this(globs, new PcreGlobConversionOptions())
+    {
+    }
+
+    /// <summary>
+    /// Creates a glob set.
+    /// </summary>
+    /// <param name="globs">The glob patterns.</param>
+    /// <param name="options">Conversion options.</param>
+    public PcreGlobSet(IEnumerable<string> globs, PcreGlobConversionOptions options)
+    {
+        if (globs == null)
+            throw new ArgumentNullException(nameof(globs));
+        if (options == null)
+            throw new ArgumentNullException(nameof(options));
+
+        _globs = globs.ToArray();
+        _separator = options.SeparatorCharacter;
+
+        var chunkBuilder = new ChunkBuilder();
+
+        for (var index = 0; index < _globs.Length; ++index)
+        {
+            var glob = _globs[index] ?? throw new ArgumentException("The glob list contains a null item.", nameof(globs));
+
+            if (!TryAddSimpleGlob(glob, index, options))
+            {
+                chunkBuilder.Add(PcreConvert.FromGlob(glob, options), index);
+
+                if (chunkBuilder.Count >= _maxChunkGlobCount || chunkBuilder.PatternLength >= _maxChunkPatternLength)
+                    _chunks.Add(chunkBuilder.Build());
+            }
+        }
+
+        if (chunkBuilder.Count != 0)
+            _chunks.Add(chunkBuilder.Build());
+    }
+
+    /// <summary>
+    /// Returns the number of globs in the set.
+    /// </summary>
+    public int Count => _globs.Length;
+
+    /// <summary>
+    /// Returns the glob patterns of the set, in the order they were provided.
+    /// </summary>
+    public IReadOnlyList<string> Globs => _globs;
+
+    /// <summary>
+    /// Indicates whether any glob of the set matches the given path.
+    /// </summary>
+    /// <param name="path">The path to match.</param>
+    public bool IsMatch(string path)
+        => IsMatch((path ?? throw new ArgumentNullException(nameof(path))).AsSpan());
+
+    /// <summary>
+    /// Indicates whether any glob of the set matches the given path.
+    /// </summary>
+    /// <param name="path">The path to match.</param>
+    public bool IsMatch(ReadOnlySpan<char> path)
+    {
+        if (_matchAll.Count != 0
+            || HasMatch(GetLiteralCandidates(path), path)
+            || HasMatch(GetSuffixCandidates(path), path)
+            || HasMatch(GetPrefixCandidates(path), path))
+        {
+            return true;
+        }
+
+        foreach (var chunk in _chunks)
+        {
+            if (MatchChunk(chunk, path, null))
+                return true;
+        }
+
+        return false;
+    }
+
+    /// <summary>
+    /// Returns the indexes of the globs which match the given path, in ascending order.
+    /// </summary>
+    /// <param name="path">The path to match.</param>
+    public int[] GetMatchingGlobs(string path)
+        => GetMatchingGlobs((path ?? throw new ArgumentNullException(nameof(path))).AsSpan());
+
+    /// <summary>
+    /// Returns the indexes of the globs which match the given path, in ascending order.
+    /// </summary>
+    /// <param name="path">The path to match.</param>
+    public int[] GetMatchingGlobs(ReadOnlySpan<char> path)
+    {
+        var result = new List<int>(_matchAll);
+
+        AddMatches(GetLiteralCandidates(path), path, result);
+        AddMatches(GetSuffixCandidates(path), path, result);
+        AddMatches(GetPrefixCandidates(path), path, result);
+
+        foreach (var chunk in _chunks)
+            MatchChunk(chunk, path, result);
+
+        result.Sort();
+        return result.ToArray();
+    }
+
+    private static bool MatchChunk(RegexChunk chunk, ReadOnlySpan<char> path, List<int>? result)
+    {
+        var buffer = chunk.Regex.RentMatchBuffer();
+
+        try
+        {
+            var match = buffer.Match(path);
+            var isMatch = false;
+
+            // Group i + 1 is set when glob i of the chunk matches.
+            for (var i = 0; i < chunk.GlobIndexes.Length; ++i)
+            {
+                if (!match[i + 1].Success)
+                    continue;
+
+                if (result == null)
+                    return true;
+
+                result.Add(chunk.GlobIndexes[i]);
+                isMatch = true;
+            }
+
+            return isMatch;
+        }
+        finally
+        {
+            chunk.Regex.ReturnMatchBuffer(buffer);
+        }
+    }
+
+    private bool TryAddSimpleGlob(string glob, int index, PcreGlobConversionOptions options)
+    {
+        var escape = options.EscapeCharacter;
+        var starStar = !options.NoStarStar;
+
+        // **
+        if (starStar && glob == "**")
+        {
+            _matchAll.Add(index);
+            return true;
+        }
+
+        // literal
+        if (IsLiteral(glob.AsSpan(), escape))
+        {
+            Add(_literals, GetHash(glob.AsSpan()), new SimpleGlob(glob, index, SimpleGlobKind.Literal));
+            return true;
+        }
+
+        // **/*suffix and *suffix
+        var prefixLength = starStar && glob.Length > 3 && glob[0] == '*' && glob[1] == '*' && glob[2] == _separator && glob[3] == '*'
+            ? 4
+            : 1;
+
+        if (glob[0] == '*' && TryGetSuffixKey(glob.AsSpan(prefixLength), escape, out var suffixKey))
+        {
+            var kind = prefixLength != 1 || options.NoWildcardSeparator ? SimpleGlobKind.SuffixAnySeparators : SimpleGlobKind.Suffix;
+            Add(_suffixes, suffixKey, new SimpleGlob(glob.Substring(prefixLength), index, kind));
+            return true;
+        }
+
+        // prefix/**
+        if (starStar && glob.Length > 3 && glob.EndsWith("**", StringComparison.Ordinal) && glob[glob.Length - 3] == _separator)
+        {
+            var prefix = glob.AsSpan(0, glob.Length - 2);
+            if (IsLiteral(prefix, escape))
+            {
+                Add(_prefixes, GetHash(prefix.Slice(0, prefix.IndexOf(_separator))), new SimpleGlob(prefix.ToString(), index, SimpleGlobKind.Prefix));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    private bool TryGetSuffixKey(ReadOnlySpan<char> suffix, char escape, out int key)
+    {
+        var extensionIndex = suffix.LastIndexOf('.');
+
+        if (extensionIndex < 0 || !IsLiteral(suffix, escape) || suffix.IndexOf(_separator) >= 0)
+        {
+            key = 0;
+            return false;
+        }
+
+        key = GetHash(suffix.Slice(extensionIndex));
+        return true;
+    }
+
+    private List<SimpleGlob>? GetLiteralCandidates(ReadOnlySpan<char> path)
+        => GetCandidates(_literals, path);
+
+    private List<SimpleGlob>? GetSuffixCandidates(ReadOnlySpan<char> path)
+    {
+        var extensionIndex = path.LastIndexOf('.');
+        return extensionIndex >= 0 ? GetCandidates(_suffixes, path.Slice(extensionIndex)) : null;
+    }
+
+    private List<SimpleGlob>? GetPrefixCandidates(ReadOnlySpan<char> path)
+    {
+        var separatorIndex = path.IndexOf(_separator);
+        return separatorIndex >= 0 ? GetCandidates(_prefixes, path.Slice(0, separatorIndex)) : null;
+    }
+
+    private bool HasMatch(List<SimpleGlob>? candidates, ReadOnlySpan<char> path)
+    {
+        if (candidates == null)
+            return false;
+
+        foreach (var candidate in candidates)
+        {
+            if (IsMatch(candidate, path))
+                return true;
+        }
+
+        return false;
+    }
+
+    private void AddMatches(List<SimpleGlob>? candidates, ReadOnlySpan<char> path, List<int> result)
+    {
+        if (candidates == null)
+            return;
+
+        foreach (var candidate in candidates)
+        {
+            if (IsMatch(candidate, path))
+                result.Add(candidate.Index);
+        }
+    }
+
+    private bool IsMatch(SimpleGlob glob, ReadOnlySpan<char> path)
+        => glob.Kind switch
+        {
+            SimpleGlobKind.Literal             => path.SequenceEqual(glob.Text.AsSpan()),
+            SimpleGlobKind.Prefix              => path.StartsWith(glob.Text.AsSpan()),
+            SimpleGlobKind.Suffix              => path.EndsWith(glob.Text.AsSpan()) && path.IndexOf(_separator) < 0,
+            SimpleGlobKind.SuffixAnySeparators => path.EndsWith(glob.Text.AsSpan()),
+            _                                  => false
+        };
+
+    private static List<SimpleGlob>? GetCandidates(Dictionary<int, List<SimpleGlob>> table, ReadOnlySpan<char> key)
+        => table.Count != 0 && table.TryGetValue(GetHash(key), out var candidates) ? candidates : null;
+
+    private static bool IsLiteral(ReadOnlySpan<char> glob, char escape)
+    {
+        foreach (var c in glob)
+        {
+            if (c is '*' or '?' or '[' || c == escape)
+                return false;
+        }
+
+        return true;
+    }
+
+    private static void Add(Dictionary<int, List<SimpleGlob>> table, int key, SimpleGlob glob)
+    {
+        if (!table.TryGetValue(key, out var list))
+            table.Add(key, list = new List<SimpleGlob>());
+
+        list.Add(glob);
+    }
+
+    private static int GetHash(ReadOnlySpan<char> value)
+    {
+        // FNV-1a
+        var hash = 2166136261;
+
+        foreach (var c in value)
+            hash = unchecked((hash ^ c) * 16777619);
+
+        return unchecked((int)hash);
+    }
+
+    private enum SimpleGlobKind
+    {
+        Literal,
+        Prefix,
+        Suffix,
+        SuffixAnySeparators
+    }
+
+    private readonly struct SimpleGlob(string text, int index, SimpleGlobKind kind)
+    {
+        public readonly string Text = text;
+        public readonly int Index = index;
+        public readonly SimpleGlobKind Kind = kind;
+    }
+
+    private sealed class RegexChunk(PcreRegex regex, int[] globIndexes)
+    {
+        public readonly PcreRegex Regex = regex;
+        public readonly int[] GlobIndexes = globIndexes;
+    }
+
+    private sealed class ChunkBuilder
+    {
+        private readonly List<string> _bodies = new();
+        private readonly List<int> _globIndexes = new();
+
+        public int Count => _bodies.Count;
+        public int PatternLength { get; private set; }
+
+        public void Add(string pattern, int globIndex)
+        {
+            var body = pattern.StartsWith("(?s)", StringComparison.Ordinal)
+                ? pattern.Substring(4)
+                : $"(?:{pattern})";
+
+            if (!body.StartsWith(@"\A", StringComparison.Ordinal))
+                body = ".*?" + body;
+
+            // The glob is converted glob is wrapped in a double negative assertion: a (*COMMIT) reached in a negative assertion only makes that assertion true,
+            // whereas in a positive assertion it would make the whole combined match fail.
+            _bodies.Add($"(?!(?!{body}))");
+            _globIndexes.Add(globIndex);
+            PatternLength += body.Length;
+        }
+
+        public RegexChunk Build()
+        {
+            // Every glob is followed by an empty group which gets set when it matches, and the combined pattern always matches.
+            var pattern = new StringBuilder(@"(?s)\A");
+
+            foreach (var body in _bodies)
+                pattern.Append("(?:").Append(body).Append("())?");
+
+            var chunk = new RegexChunk(new PcreRegex(pattern.ToString(), PcreOptions.Compiled), _globIndexes.ToArray());
+
+            if (chunk.Regex.PatternInfo.CaptureCount != chunk.GlobIndexes.Length)
+                throw new InvalidOperationException("Converted glob patterns should not contain capturing groups.");
+
+            _bodies.Clear();
+            _globIndexes.Clear();
+            PatternLength = 0;
+
+            return chunk;
+        }
+    }
+}
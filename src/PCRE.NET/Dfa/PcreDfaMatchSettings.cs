@@ -1,5 +1,6 @@
 ﻿using System;
 using System.Diagnostics.CodeAnalysis;
+using System.Threading;
 using PCRE.Internal;
 
 namespace PCRE.Dfa;
@@ -11,6 +12,8 @@ public sealed class PcreDfaMatchSettings
 {
     private static readonly PcreDfaMatchSettings _defaultSettings = new();
 
+    private TimeSpan _timeout = System.Threading.Timeout.InfiniteTimeSpan;
+
     /// <summary>
     /// Additional options.
     /// </summary>
@@ -35,6 +38,42 @@ public sealed class PcreDfaMatchSettings
     /// </remarks>
     public uint WorkspaceSize { get; set; } = 128;
 
+    /// <summary>
+    /// The maximum amount of time a match can take, or <see cref="System.Threading.Timeout.InfiniteTimeSpan"/> for no timeout.
+    /// </summary>
+    /// <remarks>
+    /// See <see cref="PcreMatchSettings.Timeout"/>.
+    /// </remarks>
+    public TimeSpan Timeout
+    {
+        get => _timeout;
+        set => _timeout = PcreMatchSettings.ValidateTimeout(value);
+    }
+
+    /// <summary>
+    /// A cancellation token which abandons the match when cancelled.
+    /// </summary>
+    /// <remarks>
+    /// See <see cref="PcreMatchSettings.CancellationToken"/>.
+    /// </remarks>
+    public CancellationToken CancellationToken { get; set; }
+
+    /// <summary>
+    /// Selects the callouts which are passed to <see cref="OnCallout"/>, or <c>null</c> to pass all of them.
+    /// </summary>
+    /// <remarks>
+    /// See <see cref="PcreMatchSettings.CalloutFilter"/>.
+    /// </remarks>
+    public PcreCalloutFilter? CalloutFilter { get; set; }
+
+    /// <summary>
+    /// Whether the <see cref="PcreCallout"/> object passed to <see cref="OnCallout"/> is reused between the callouts of a match.
+    /// </summary>
+    /// <remarks>
+    /// See <see cref="PcreMatchSettings.ReuseCallouts"/>.
+    /// </remarks>
+    public bool ReuseCallouts { get; set; }
+
     /// <summary>
     /// A function to be called when a callout point is reached during the match.
     /// </summary>
@@ -65,5 +104,7 @@ public sealed class PcreDfaMatchSettings
     {
         input.max_results = (AdditionalOptions & PcreDfaMatchOptions.DfaShortest) != 0 ? 1 : Math.Max(1, MaxResults);
         input.workspace_size = WorkspaceSize;
+        input.settings = default;
+        input.settings.timeout = PcreMatchSettings.GetNativeTimeout(_timeout);
     }
 }
@@ -6,7 +6,8 @@ internal static class Caches
 {
     private const int _defaultCacheSize = 15;
 
-    internal static readonly PriorityCache<RegexKey, InternalRegex16Bit> RegexCache = new(_defaultCacheSize, key => new InternalRegex16Bit(key.Pattern, key.Settings));
+    internal static readonly InternTable<RegexKey, InternalRegex16Bit> RegexInternTable = new(key => new InternalRegex16Bit(key.Pattern, key.Settings));
+    internal static readonly PriorityCache<RegexKey, InternalRegex16Bit> RegexCache = new(_defaultCacheSize, RegexInternTable.GetOrAdd, recordMetrics: true);
     internal static readonly PriorityCache<string, Func<PcreMatch, string>> ReplacementCache = new(_defaultCacheSize, ReplacementPattern.Parse);
 
     public static int CacheSize
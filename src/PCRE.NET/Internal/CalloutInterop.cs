@@ -98,12 +98,13 @@ internal static unsafe class CalloutInterop
                                              scoped ref Native.match_input input,
                                              out CalloutInteropInfo<TChar> interopInfo,
                                              Delegate? callout,
-                                             nuint[]? calloutOutputVector)
+                                             nuint[]? calloutOutputVector,
+                                             bool reuseCallouts)
         where TChar : unmanaged
     {
         if (callout != null)
         {
-            interopInfo = new CalloutInteropInfo<TChar>(subject, regex, callout, calloutOutputVector);
+            interopInfo = new CalloutInteropInfo<TChar>(subject, regex, callout, calloutOutputVector, reuseCallouts);
 
             input.callout = sizeof(TChar) switch
             {
@@ -130,7 +131,7 @@ internal static unsafe class CalloutInterop
     {
         if (callout != null)
         {
-            interopInfo = new CalloutInteropInfo<TChar>(subject, (InternalRegex<TChar>)buffer.Regex, callout, buffer.CalloutOutputVector);
+            interopInfo = new CalloutInteropInfo<TChar>(subject, (InternalRegex<TChar>)buffer.Regex, callout, buffer.CalloutOutputVector, false);
 
             input.callout = sizeof(TChar) switch
             {
@@ -152,12 +153,13 @@ internal static unsafe class CalloutInterop
                                      InternalRegex16Bit regex,
                                      scoped ref Native.dfa_match_input input,
                                      out CalloutInteropInfo<char> interopInfo,
-                                     Func<PcreCallout, PcreCalloutResult>? callout)
+                                     Func<PcreCallout, PcreCalloutResult>? callout,
+                                     bool reuseCallouts)
     {
         if (callout != null)
         {
             var wrapper = new StringCalloutWrapper(() => (subject, callout));
-            interopInfo = new CalloutInteropInfo<char>([], regex, wrapper, []);
+            interopInfo = new CalloutInteropInfo<char>([], regex, wrapper, [], reuseCallouts);
 
             input.callout = _calloutHandlerFnPtr16Bit;
             input.callout_data = interopInfo.ToPointer();
@@ -263,15 +265,19 @@ internal static unsafe class CalloutInterop
         private readonly InternalRegex<TChar> _regex;
         private readonly Delegate _callout;
         private readonly nuint[]? _outputVector;
+        private readonly bool _reuseCallouts;
+        private PcreCallout? _reusableCallout;
 
         public Exception? Exception { get; private set; }
 
-        public CalloutInteropInfo(ReadOnlySpan<TChar> subject, InternalRegex<TChar> regex, Delegate callout, nuint[]? outputVector)
+        public CalloutInteropInfo(ReadOnlySpan<TChar> subject, InternalRegex<TChar> regex, Delegate callout, nuint[]? outputVector, bool reuseCallouts)
         {
             _subject = subject;
             _regex = regex;
             _callout = callout;
             _outputVector = outputVector;
+            _reuseCallouts = reuseCallouts;
+            _reusableCallout = null;
 
             Exception = null;
         }
@@ -324,7 +330,16 @@ internal static unsafe class CalloutInterop
                         case StringCalloutWrapper wrapper:
                         {
                             var (subject, func) = wrapper();
-                            return (int)func(new PcreCallout(subject, _regex, callout));
+
+                            if (!_reuseCallouts)
+                                return (int)func(new PcreCallout(subject, _regex, callout));
+
+                            if (_reusableCallout is null)
+                                _reusableCallout = new PcreCallout(subject, _regex, callout);
+                            else
+                                _reusableCallout.Update(callout);
+
+                            return (int)func(_reusableCallout);
                         }
                     }
                 }
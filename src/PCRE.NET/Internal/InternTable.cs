@@ -0,0 +1,88 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+
+namespace PCRE.Internal;
+
+/// <summary>
+/// Maps keys to values which are shared as long as they are referenced somewhere else.
+/// </summary>
+internal class InternTable<TKey, TValue>
+    where TKey : notnull
+    where TValue : class
+{
+    private const int _minPruneThreshold = 32;
+
+    private readonly Func<TKey, TValue> _valueFactory;
+    private readonly Dictionary<TKey, WeakReference<TValue>> _items;
+
+#if NET9_0_OR_GREATER
+    private readonly Lock _lock = new();
+#else
+    private readonly object _lock = new();
+#endif
+
+    private int _pruneThreshold = _minPruneThreshold;
+
+    public InternTable(Func<TKey, TValue> valueFactory, IEqualityComparer<TKey>? keyComparer = null)
+    {
+        _valueFactory = valueFactory;
+        _items = new Dictionary<TKey, WeakReference<TValue>>(keyComparer ?? EqualityComparer<TKey>.Default);
+    }
+
+    /// <summary>
+    /// The number of live values.
+    /// </summary>
+    public int Count
+    {
+        get
+        {
+            lock (_lock)
+            {
+                return _items.Values.Count(i => i.TryGetTarget(out _));
+            }
+        }
+    }
+
+    public TValue GetOrAdd(TKey key)
+    {
+        lock (_lock)
+        {
+            if (_items.TryGetValue(key, out var item) && item.TryGetTarget(out var value))
+                return value;
+        }
+
+        // Create the value outside of the lock, as this may be expensive (compiling a pattern)
+        var newValue = _valueFactory(key);
+
+        lock (_lock)
+        {
+            if (_items.TryGetValue(key, out var item) && item.TryGetTarget(out var value))
+            {
+                // Another thread created the same value in the meantime
+                (newValue as IDisposable)?.Dispose();
+                return value;
+            }
+
+            if (_items.Count >= _pruneThreshold)
+            {
+                Prune();
+                _pruneThreshold = Math.Max(_items.Count * 2, _minPruneThreshold);
+            }
+
+            _items[key] = new WeakReference<TValue>(newValue);
+            return newValue;
+        }
+    }
+
+    private void Prune()
+    {
+        var deadKeys = _items.Where(i => !i.Value.TryGetTarget(out _))
+                             .Select(i => i.Key)
+                             .ToList();
+
+        foreach (var key in deadKeys)
+            _items.Remove(key);
+    }
+}
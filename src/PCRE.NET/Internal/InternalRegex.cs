@@ -2,6 +2,7 @@
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.Diagnostics.CodeAnalysis;
+using System.Runtime.InteropServices;
 using System.Text;
 using System.Threading;
 using PCRE.Dfa;
@@ -15,7 +16,18 @@ internal abstract unsafe class InternalRegex : IDisposable
 
     private Dictionary<int, PcreCalloutInfo>? _calloutInfoByPatternPosition;
 
+    // Weak handles to the regex objects which share this compiled pattern, the collected ones are freed when the array is full
+    private GCHandle[] _instanceHandles = [];
+    private int _instanceHandleCount;
+
+#if NET9_0_OR_GREATER
+    private readonly Lock _instanceLock = new();
+#else
+    private readonly object _instanceLock = new();
+#endif
+
     public void* Code { get; protected set; }
+    public bool IsJitCompiled { get; protected set; }
 
     internal Dictionary<string, int[]> CaptureNames { get; init; } = null!;
     internal int CaptureCount { get; init; }
@@ -26,6 +38,25 @@ internal abstract unsafe class InternalRegex : IDisposable
     public string PatternString { get; }
     public PcreRegexSettings Settings { get; }
 
+    public virtual int InstanceCount
+    {
+        get
+        {
+            lock (_instanceLock)
+            {
+                var count = 0;
+
+                for (var i = 0; i < _instanceHandleCount; ++i)
+                {
+                    if (_instanceHandles[i].Target is not null)
+                        ++count;
+                }
+
+                return count;
+            }
+        }
+    }
+
     protected InternalRegex(string patternString, PcreRegexSettings settings)
     {
         if (!settings.ReadOnlySettings)
@@ -36,16 +67,71 @@ internal abstract unsafe class InternalRegex : IDisposable
     }
 
     ~InternalRegex()
-        => FreeCode();
+    {
+        FreeCode();
+        FreeInstanceHandles();
+    }
 
     public void Dispose()
     {
         FreeCode();
+        FreeInstanceHandles();
         GC.SuppressFinalize(this);
     }
 
     protected abstract void FreeCode();
 
+    /// <summary>
+    /// Counts a regex object as an instance of this compiled pattern, for as long as it is alive.
+    /// </summary>
+    /// <remarks>
+    /// Weak handles don't allocate managed memory and don't need a finalizer on the regex object.
+    /// </remarks>
+    public void AddInstance(object instance)
+    {
+        lock (_instanceLock)
+        {
+            if (_instanceHandleCount == _instanceHandles.Length)
+                PruneInstanceHandles();
+
+            _instanceHandles[_instanceHandleCount++] = GCHandle.Alloc(instance, GCHandleType.Weak);
+        }
+    }
+
+    private void PruneInstanceHandles()
+    {
+        var count = 0;
+
+        for (var i = 0; i < _instanceHandleCount; ++i)
+        {
+            var handle = _instanceHandles[i];
+
+            if (handle.Target is null)
+                handle.Free();
+            else
+                _instanceHandles[count++] = handle;
+        }
+
+        Array.Clear(_instanceHandles, count, _instanceHandleCount - count);
+        _instanceHandleCount = count;
+
+        // Grow the array when most instances are still alive, so pruning stays amortized
+        if (count >= _instanceHandles.Length / 2)
+            Array.Resize(ref _instanceHandles, Math.Max(2 * _instanceHandles.Length, 4));
+    }
+
+    private void FreeInstanceHandles()
+    {
+        lock (_instanceLock)
+        {
+            for (var i = 0; i < _instanceHandleCount; ++i)
+                _instanceHandles[i].Free();
+
+            _instanceHandles = [];
+            _instanceHandleCount = 0;
+        }
+    }
+
     public abstract IReadOnlyList<PcreCalloutInfo> GetCallouts();
 
     [return: NotNullIfNotNull(nameof(ptr))]
@@ -72,17 +158,92 @@ internal abstract unsafe class InternalRegex : IDisposable
 
     public PcreCalloutInfo GetCalloutInfoByPatternPosition(int patternPosition)
         => TryGetCalloutInfoByPatternPosition(patternPosition) ?? throw new InvalidOperationException($"Could not retrieve callout info at position {patternPosition}.");
+
+    /// <summary>
+    /// Sets up the flag which is checked by native code to abandon a match when the token is cancelled.
+    /// </summary>
+    /// <remarks>
+    /// The flag must stay valid until the returned registration is disposed.
+    /// </remarks>
+    protected static CancellationTokenRegistration RegisterCancellation(CancellationToken cancellationToken, int* flag, out int* cancellationFlag)
+    {
+        cancellationToken.ThrowIfCancellationRequested();
+
+        if (!cancellationToken.CanBeCanceled)
+        {
+            cancellationFlag = null;
+            return default;
+        }
+
+        cancellationFlag = flag;
+        return cancellationToken.Register(static state => Volatile.Write(ref *(int*)(IntPtr)state!, 1), (IntPtr)flag);
+    }
+
+    protected Metrics.MatchEngine GetMatchEngine(uint additionalOptions)
+        => IsJitCompiled && (additionalOptions & PcreConstants.PCRE2_NO_JIT) == 0
+            ? Metrics.MatchEngine.Jit
+            : Metrics.MatchEngine.Interpreter;
+
+    protected static void ThrowDeadlineError(int resultCode, TimeSpan timeout, CancellationToken cancellationToken)
+    {
+        switch (resultCode)
+        {
+            case (int)PcreErrorCode.MatchTimeout:
+                throw new PcreMatchTimeoutException(timeout);
+
+            case (int)PcreErrorCode.MatchCancelled:
+                cancellationToken.ThrowIfCancellationRequested();
+                throw new OperationCanceledException();
+        }
+    }
 }
 
-[SuppressMessage("ReSharper", "UnusedTypeParameter")]
 internal abstract class InternalRegex<TChar>(string patternString, PcreRegexSettings settings)
     : InternalRegex(patternString, settings)
-    where TChar : unmanaged;
+    where TChar : unmanaged
+{
+    /// <summary>
+    /// Indicates whether the subject is valid UTF without calling into native code: UTF-16 without surrogates, or ASCII UTF-8.
+    /// </summary>
+    public static bool IsTriviallyValidUtf(ReadOnlySpan<TChar> subject)
+    {
+        if (typeof(TChar) == typeof(char))
+        {
+#if NET8_0_OR_GREATER
+            return !MemoryMarshal.Cast<TChar, char>(subject).ContainsAnyInRange('\uD800', '\uDFFF');
+#else
+            foreach (var c in MemoryMarshal.Cast<TChar, char>(subject))
+            {
+                if (char.IsSurrogate(c))
+                    return false;
+            }
+
+            return true;
+#endif
+        }
+
+#if NET8_0_OR_GREATER
+        return System.Text.Ascii.IsValid(MemoryMarshal.Cast<TChar, byte>(subject));
+#else
+        foreach (var b in MemoryMarshal.Cast<TChar, byte>(subject))
+        {
+            if (b >= 0x80)
+                return false;
+        }
+
+        return true;
+#endif
+    }
+}
 
 internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TChar>
     where TChar : unmanaged
     where TNative : struct, INative
 {
+    private IntPtr _autoCalloutCode;
+    private readonly LiteralPattern<TChar>? _literalPattern;
+    private readonly MatchPrefilter<TChar>? _prefilter;
+
     protected InternalRegex(ReadOnlySpan<TChar> pattern, string patternString, PcreRegexSettings settings)
         : base(patternString, settings)
     {
@@ -92,6 +253,12 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
         CaptureCount = captureCount;
         CaptureNames = captureNames;
 
+        _literalPattern = LiteralPattern<TChar>.TryCreate(pattern, settings, captureCount);
+
+        Native.prefilter_info prefilterInfo;
+        default(TNative).get_prefilter_info(Code, &prefilterInfo);
+        _prefilter = MatchPrefilter<TChar>.Create(prefilterInfo);
+
         GC.KeepAlive(this);
     }
 
@@ -108,10 +275,38 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
 
             input.pattern = pPattern;
             input.pattern_length = (uint)pattern.Length;
+            input.serialized_code = null;
+            input.serialized_code_size = 0;
+
+            var startTimestamp = Metrics.GetCompileTimestamp();
 
             using (Settings.FillCompileInput(ref input))
             {
-                default(TNative).compile(&input, &result);
+                var cacheDirectory = PersistentCache.Directory;
+
+                if (cacheDirectory is null && !PersistentCache.HasPrecompiledEntries)
+                {
+                    default(TNative).compile(&input, &result);
+                }
+                else
+                {
+                    var cacheKey = PersistentCache.GetKey(ref input, MemoryMarshal.AsBytes(pattern), sizeof(TChar));
+                    var serializedCode = PersistentCache.Load(cacheDirectory, cacheKey);
+
+                    fixed (byte* pSerializedCode = serializedCode.AsSpan())
+                    {
+                        input.serialized_code = pSerializedCode;
+                        input.serialized_code_size = (uint)serializedCode.Count;
+
+                        default(TNative).compile(&input, &result);
+                    }
+
+                    if (result.deserialized != 0)
+                        PersistentCache.RecordHit();
+                    else if (result.code != null && cacheDirectory is not null)
+                        PersistentCache.Store<TNative>(cacheDirectory, cacheKey, result.code);
+                }
+
                 Code = result.code;
             }
 
@@ -120,6 +315,9 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
                 Dispose();
                 throw new PcrePatternException((PcreErrorCode)result.error_code, $"Invalid pattern '{PatternString}': {default(TNative).GetErrorMessage(result.error_code)} at offset {result.error_offset}.");
             }
+
+            IsJitCompiled = input.flags_jit != 0 && result.jit_error_code == 0;
+            Metrics.RecordCompile(startTimestamp, input.flags_jit != 0, result.jit_error_code, result.jit_duration);
         }
 
         captureCount = (int)result.capture_count;
@@ -128,6 +326,10 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
 
     protected override void FreeCode()
     {
+        var autoCalloutCode = (void*)Interlocked.Exchange(ref _autoCalloutCode, IntPtr.Zero);
+        if (autoCalloutCode != null && autoCalloutCode != Code)
+            default(TNative).code_free(autoCalloutCode);
+
         if (Code != null)
         {
             default(TNative).code_free(Code);
@@ -135,6 +337,76 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
         }
     }
 
+    protected abstract ReadOnlySpan<TChar> GetPattern();
+
+    public int PatternLength => GetPattern().Length;
+
+    /// <summary>
+    /// Returns the code to use for a match, which is compiled with automatic callouts when the match collects statistics or a profile.
+    /// </summary>
+    public void* GetMatchCode(scoped ref Native.match_settings settings)
+    {
+        if (settings.collect_stats == 0 && settings.collect_profile == 0)
+            return Code;
+
+        var code = (void*)Volatile.Read(ref _autoCalloutCode);
+        if (code == null)
+            code = GetAutoCalloutCode();
+
+        settings.auto_callouts = code != Code ? 1u : 0u;
+        return code;
+    }
+
+    private void* GetAutoCalloutCode()
+    {
+        // Automatic callouts are numbered 255, so they can't be told apart from an explicit callout 255.
+        // Such patterns are matched without automatic callouts, and produce no step counts nor profile.
+
+        var code = Code;
+
+        foreach (var callout in GetCallouts())
+        {
+            if (callout.Number == 255 && callout.String is null)
+                return InitAutoCalloutCode(code);
+        }
+
+        Native.compile_result result;
+
+        fixed (TChar* pPattern = GetPattern())
+        {
+            Native.compile_input input;
+            _ = &input;
+
+            input.pattern = pPattern;
+            input.pattern_length = (uint)GetPattern().Length;
+            input.serialized_code = null;
+            input.serialized_code_size = 0;
+
+            using (Settings.FillCompileInput(ref input))
+            {
+                input.flags |= PcreConstants.PCRE2_AUTO_CALLOUT;
+                default(TNative).compile(&input, &result);
+            }
+        }
+
+        if (result.code != null && result.error_code == 0)
+            code = result.code;
+
+        return InitAutoCalloutCode(code);
+
+        void* InitAutoCalloutCode(void* newCode)
+        {
+            var existingCode = (void*)Interlocked.CompareExchange(ref _autoCalloutCode, (IntPtr)newCode, IntPtr.Zero);
+            if (existingCode == null)
+                return newCode;
+
+            if (newCode != Code)
+                default(TNative).code_free(newCode);
+
+            return existingCode;
+        }
+    }
+
     public void Match(ref Span<nuint> matchOVector,
                       ReadOnlySpan<TChar> subject,
                       PcreMatchSettings settings,
@@ -145,11 +417,40 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
                       out TChar* markPtr,
                       out int resultCode)
     {
+        if (_literalPattern is { } literalPattern && literalPattern.CanMatch(subject, settings.AllowsLiteralMatch, startIndex, additionalOptions, callout))
+        {
+            var index = LiteralMatch(literalPattern, subject, startIndex);
+
+            if (index >= 0)
+            {
+                if (matchOVector.Length != OutputVectorSize)
+                    matchOVector = new nuint[OutputVectorSize];
+
+                matchOVector[0] = (nuint)index;
+                matchOVector[1] = (nuint)(index + literalPattern.Length);
+            }
+
+            markPtr = null;
+            resultCode = index >= 0 ? 1 : PcreConstants.PCRE2_ERROR_NOMATCH;
+            return;
+        }
+
+        if (_prefilter is { } prefilter && prefilter.RejectsMatch(subject, settings.AllowsPrefilter, ref startIndex, ref additionalOptions, IsJitCompiled))
+        {
+            Metrics.RecordMatch(GetMatchEngine(additionalOptions));
+            markPtr = null;
+            resultCode = PcreConstants.PCRE2_ERROR_NOMATCH;
+            return;
+        }
+
         Native.match_input input;
         _ = &input;
 
         settings.FillMatchSettings(ref input.settings, out var jitStack);
 
+        var cancelled = 0;
+        using var cancellation = RegisterCancellation(settings.CancellationToken, &cancelled, out input.settings.cancellation_flag);
+
         Native.match_result result;
         CalloutInterop.CalloutInteropInfo<TChar> calloutInterop;
 
@@ -163,15 +464,18 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
 
         fixed (TChar* pSubject = subject)
         fixed (nuint* pOVec = &oVector[0])
+        fixed (uint* pCalloutFilter = settings.CalloutFilter?.GetData(this))
         {
-            input.code = Code;
+            input.code = GetMatchCode(ref input.settings);
             input.subject = pSubject;
             input.subject_length = (uint)subject.Length;
             input.output_vector = pOVec;
             input.start_index = (uint)startIndex;
             input.additional_options = additionalOptions;
+            input.settings.callout_filter = pCalloutFilter;
+            input.ranges_only = 0;
 
-            CalloutInterop.PrepareForSpan(subject, this, ref input, out calloutInterop, callout, calloutOutputVector);
+            CalloutInterop.PrepareForSpan(subject, this, ref input, out calloutInterop, callout, calloutOutputVector, settings.ReuseCallouts);
 
             default(TNative).match(&input, &result);
 
@@ -179,8 +483,10 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
             GC.KeepAlive(jitStack);
         }
 
+        Metrics.RecordMatch(GetMatchEngine(additionalOptions));
+
         if (result.result_code < PcreConstants.PCRE2_ERROR_PARTIAL)
-            HandleError(result, ref calloutInterop);
+            HandleError(result, ref calloutInterop, settings.Timeout, settings.CancellationToken);
 
         if (result.result_code != PcreConstants.PCRE2_ERROR_NOMATCH && oVector != matchOVector)
             oVectorArray ??= oVector.ToArray();
@@ -192,6 +498,92 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
         resultCode = result.result_code;
     }
 
+    /// <summary>
+    /// Matches without capturing groups: the output vector receives the range of the match, followed by the ranges of the <paramref name="outputGroups"/>.
+    /// </summary>
+    public int MatchRanges(Span<nuint> oVector,
+                           ReadOnlySpan<TChar> subject,
+                           ReadOnlySpan<int> outputGroups,
+                           PcreMatchSettings settings,
+                           int startIndex,
+                           uint additionalOptions)
+    {
+        if (_literalPattern is { } literalPattern && literalPattern.CanMatch(subject, settings.AllowsLiteralMatch, startIndex, additionalOptions, null))
+        {
+            var index = LiteralMatch(literalPattern, subject, startIndex);
+            if (index < 0)
+                return PcreConstants.PCRE2_ERROR_NOMATCH;
+
+            oVector[0] = (nuint)index;
+            oVector[1] = (nuint)(index + literalPattern.Length);
+
+            // A literal pattern has no capturing group, so the only group which can be requested is the overall match.
+            for (var i = 0; i < outputGroups.Length; ++i)
+            {
+                oVector[2 * i + 2] = oVector[0];
+                oVector[2 * i + 3] = oVector[1];
+            }
+
+            return 1;
+        }
+
+        if (_prefilter is { } prefilter && prefilter.RejectsMatch(subject, settings.AllowsPrefilter, ref startIndex, ref additionalOptions, IsJitCompiled))
+        {
+            Metrics.RecordMatch(GetMatchEngine(additionalOptions));
+            return PcreConstants.PCRE2_ERROR_NOMATCH;
+        }
+
+        Native.match_input input;
+        _ = &input;
+
+        settings.FillMatchSettings(ref input.settings, out var jitStack);
+
+        var cancelled = 0;
+        using var cancellation = RegisterCancellation(settings.CancellationToken, &cancelled, out input.settings.cancellation_flag);
+
+        Native.match_result result;
+        var calloutInterop = default(CalloutInterop.CalloutInteropInfo<TChar>);
+
+        fixed (TChar* pSubject = subject)
+        fixed (nuint* pOVec = oVector)
+        fixed (int* pOutputGroups = outputGroups)
+        {
+            input.code = GetMatchCode(ref input.settings);
+            input.subject = pSubject;
+            input.subject_length = (uint)subject.Length;
+            input.output_vector = pOVec;
+            input.start_index = (uint)startIndex;
+            input.additional_options = additionalOptions;
+            input.settings.callout_filter = null;
+            input.callout = null;
+            input.ranges_only = 1;
+            input.output_group_count = (uint)outputGroups.Length;
+            input.output_groups = (uint*)pOutputGroups;
+
+            default(TNative).match(&input, &result);
+
+            GC.KeepAlive(this);
+            GC.KeepAlive(jitStack);
+        }
+
+        Metrics.RecordMatch(GetMatchEngine(additionalOptions));
+
+        if (result.result_code < PcreConstants.PCRE2_ERROR_PARTIAL)
+            HandleError(result, ref calloutInterop, settings.Timeout, settings.CancellationToken);
+
+        return result.result_code;
+    }
+
+    /// <summary>
+    /// Performs a match of a literal pattern without calling into PCRE2, and returns the index of the match or -1.
+    /// </summary>
+    private static int LiteralMatch(LiteralPattern<TChar> literalPattern, ReadOnlySpan<TChar> subject, int startIndex)
+    {
+        var index = literalPattern.IndexOf(subject, startIndex);
+        Metrics.RecordMatch(Metrics.MatchEngine.Literal);
+        return index;
+    }
+
     public void BufferMatch(ReadOnlySpan<TChar> subject,
                             IPcreMatchBuffer buffer,
                             int startIndex,
@@ -200,12 +592,46 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
                             out TChar* markPtr,
                             out int resultCode)
     {
+        if (buffer.NativeBuffer == IntPtr.Zero)
+            ThrowMatchBufferDisposed();
+
+        if (buffer.PoolState == MatchBufferPool.Returned)
+            ThrowMatchBufferReturned();
+
+        // The buffer captures whether its settings allow these, as its native settings can't change.
+        if (_literalPattern is { } literalPattern && literalPattern.CanMatch(subject, buffer.AllowsLiteralMatch, startIndex, additionalOptions, callout))
+        {
+            var index = LiteralMatch(literalPattern, subject, startIndex);
+
+            if (index >= 0)
+            {
+                var oVector = buffer.OutputVector;
+                oVector[0] = (nuint)index;
+                oVector[1] = (nuint)(index + literalPattern.Length);
+            }
+
+            markPtr = null;
+            resultCode = index >= 0 ? 1 : PcreConstants.PCRE2_ERROR_NOMATCH;
+            return;
+        }
+
+        if (_prefilter is { } prefilter && prefilter.RejectsMatch(subject, buffer.AllowsPrefilter, ref startIndex, ref additionalOptions, IsJitCompiled))
+        {
+            Metrics.RecordMatch(GetMatchEngine(additionalOptions));
+            markPtr = null;
+            resultCode = PcreConstants.PCRE2_ERROR_NOMATCH;
+            return;
+        }
+
         Native.buffer_match_input input;
         _ = &input;
 
         Native.match_result result;
         CalloutInterop.CalloutInteropInfo<TChar> calloutInterop;
 
+        var cancelled = 0;
+        using var cancellation = RegisterCancellation(buffer.CancellationToken, &cancelled, out input.cancellation_flag);
+
         fixed (TChar* pSubject = subject)
         {
             input.buffer = (void*)buffer.NativeBuffer;
@@ -215,9 +641,6 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
             input.additional_options = additionalOptions;
             input.callout = null;
 
-            if (input.buffer == null)
-                ThrowMatchBufferDisposed();
-
             CalloutInterop.PrepareForBuffer(subject, buffer, ref input, out calloutInterop, callout);
 
             default(TNative).buffer_match(&input, &result);
@@ -225,8 +648,10 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
             GC.KeepAlive(buffer); // The buffer keeps alive all the other required stuff
         }
 
+        Metrics.RecordMatch(buffer.CollectStatistics ? Metrics.MatchEngine.Interpreter : GetMatchEngine(additionalOptions));
+
         if (result.result_code < PcreConstants.PCRE2_ERROR_PARTIAL)
-            HandleError(result, ref calloutInterop);
+            HandleError(result, ref calloutInterop, buffer.Timeout, buffer.CancellationToken);
 
         markPtr = (TChar*)result.mark;
         resultCode = result.result_code;
@@ -234,9 +659,27 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
 
         static void ThrowMatchBufferDisposed()
             => throw new ObjectDisposedException("The match buffer has been disposed");
+
+        static void ThrowMatchBufferReturned()
+            => throw new InvalidOperationException("The match buffer has been returned to its pool");
+    }
+
+    public static bool IsValidUtf(ReadOnlySpan<TChar> subject, out int errorOffset)
+    {
+        uint offset;
+        int resultCode;
+
+        fixed (TChar* pSubject = subject)
+            resultCode = default(TNative).valid_utf(pSubject, (uint)subject.Length, &offset);
+
+        errorOffset = resultCode == 0 ? -1 : (int)offset;
+        return resultCode == 0;
     }
 
-    protected static void HandleError(in Native.match_result result, ref CalloutInterop.CalloutInteropInfo<TChar> calloutInterop)
+    protected static void HandleError(in Native.match_result result,
+                                      ref CalloutInterop.CalloutInteropInfo<TChar> calloutInterop,
+                                      TimeSpan timeout,
+                                      CancellationToken cancellationToken)
     {
         switch (result.result_code)
         {
@@ -247,9 +690,17 @@ internal abstract unsafe class InternalRegex<TChar, TNative> : InternalRegex<TCh
             case PcreConstants.PCRE2_ERROR_CALLOUT:
                 throw new PcreCalloutException("An exception was thrown by the callout: " + calloutInterop.Exception?.Message, calloutInterop.Exception);
 
+            case (int)PcreErrorCode.MatchTimeout:
+            case (int)PcreErrorCode.MatchCancelled:
+                ThrowDeadlineError(result.result_code, timeout, cancellationToken);
+                break;
+
             default:
                 if (result.result_code < 0)
+                {
+                    Metrics.RecordMatchError(result.result_code);
                     throw new PcreMatchException((PcreErrorCode)result.result_code);
+                }
 
                 break;
         }
@@ -330,8 +781,31 @@ internal sealed unsafe class InternalRegex8Bit(ReadOnlySpan<byte> pattern, strin
 {
     public Encoding Encoding => encoding;
 
+    private readonly byte[] _pattern = pattern.ToArray();
+    private MatchBufferPool<PcreMatchBuffer8Bit>? _matchBufferPool;
+
     InternalRegex8Bit IRegexHolder8Bit.Regex => this;
 
+    // 8-bit compiled patterns are not shared
+    public override int InstanceCount => 1;
+
+    public MatchBufferPool<PcreMatchBuffer8Bit> MatchBufferPool
+    {
+        get
+        {
+            return _matchBufferPool ?? CreatePool();
+
+            MatchBufferPool<PcreMatchBuffer8Bit> CreatePool()
+            {
+                Interlocked.CompareExchange(ref _matchBufferPool, new MatchBufferPool<PcreMatchBuffer8Bit>(() => new PcreMatchBuffer8Bit(this, PcreMatchSettings.Default)), null);
+                return _matchBufferPool;
+            }
+        }
+    }
+
+    protected override ReadOnlySpan<byte> GetPattern()
+        => _pattern;
+
     public string GetString(ReadOnlySpan<byte> value)
         => GetString(value, Encoding);
 
@@ -418,9 +892,27 @@ internal sealed unsafe class InternalRegex16Bit(string pattern, PcreRegexSetting
       IRegexHolder16Bit
 {
     private PcreMatch? _noMatch;
+    private MatchBufferPool<PcreMatchBuffer>? _matchBufferPool;
 
     InternalRegex16Bit IRegexHolder16Bit.Regex => this;
 
+    public MatchBufferPool<PcreMatchBuffer> MatchBufferPool
+    {
+        get
+        {
+            return _matchBufferPool ?? CreatePool();
+
+            MatchBufferPool<PcreMatchBuffer> CreatePool()
+            {
+                Interlocked.CompareExchange(ref _matchBufferPool, new MatchBufferPool<PcreMatchBuffer>(() => new PcreMatchBuffer(this, PcreMatchSettings.Default)), null);
+                return _matchBufferPool;
+            }
+        }
+    }
+
+    protected override ReadOnlySpan<char> GetPattern()
+        => PatternString.AsSpan();
+
     public PcreMatch Match(string subject,
                            PcreMatchSettings settings,
                            int startIndex,
@@ -457,29 +949,36 @@ internal sealed unsafe class InternalRegex16Bit(string pattern, PcreRegexSetting
 
         settings.FillMatchInput(ref input);
 
+        var cancelled = 0;
+        using var cancellation = RegisterCancellation(settings.CancellationToken, &cancelled, out input.settings.cancellation_flag);
+
         var oVector = new nuint[2 * Math.Max(1, settings.MaxResults)];
         Native.match_result result;
         CalloutInterop.CalloutInteropInfo<char> calloutInterop;
 
         fixed (char* pSubject = subject)
         fixed (nuint* pOVec = &oVector[0])
+        fixed (uint* pCalloutFilter = settings.CalloutFilter?.GetData(this))
         {
-            input.code = Code;
+            input.code = GetMatchCode(ref input.settings);
             input.subject = pSubject;
             input.subject_length = (uint)subject.Length;
             input.output_vector = pOVec;
             input.start_index = (uint)startIndex;
             input.additional_options = additionalOptions;
+            input.settings.callout_filter = pCalloutFilter;
 
-            CalloutInterop.PrepareForDfa(subject, this, ref input, out calloutInterop, settings.Callout);
+            CalloutInterop.PrepareForDfa(subject, this, ref input, out calloutInterop, settings.Callout, settings.ReuseCallouts);
 
             default(Native16Bit).dfa_match(&input, &result);
 
             GC.KeepAlive(this);
         }
 
+        Metrics.RecordMatch(Metrics.MatchEngine.Dfa);
+
         if (result.result_code < PcreConstants.PCRE2_ERROR_PARTIAL)
-            HandleError(result, ref calloutInterop);
+            HandleError(result, ref calloutInterop, settings.Timeout, settings.CancellationToken);
 
         return new PcreDfaMatchResult(subject, ref result, oVector);
     }
@@ -500,7 +999,11 @@ internal sealed unsafe class InternalRegex16Bit(string pattern, PcreRegexSetting
         Native.substitute_input input;
         _ = &input;
 
-        (settings ?? PcreMatchSettings.Default).FillMatchSettings(ref input.settings, out var jitStack);
+        settings ??= PcreMatchSettings.Default;
+        settings.FillMatchSettings(ref input.settings, out var jitStack);
+
+        var cancelled = 0;
+        using var cancellation = RegisterCancellation(settings.CancellationToken, &cancelled, out input.settings.cancellation_flag);
 
         Native.substitute_result result;
         CalloutInterop.SubstituteCalloutInteropInfo calloutInterop;
@@ -511,8 +1014,10 @@ internal sealed unsafe class InternalRegex16Bit(string pattern, PcreRegexSetting
 
         fixed (char* pSubject = subject)
         fixed (char* pReplacement = replacement)
+        fixed (uint* pCalloutFilter = settings.CalloutFilter?.GetData(this))
         {
-            input.code = Code;
+            input.code = GetMatchCode(ref input.settings);
+            input.settings.callout_filter = pCalloutFilter;
             input.subject = pSubject;
             input.subject_length = (uint)subject.Length;
             input.start_index = (uint)startIndex;
@@ -530,6 +1035,8 @@ internal sealed unsafe class InternalRegex16Bit(string pattern, PcreRegexSetting
             substituteCallCount = result.substitute_call_count;
         }
 
+        Metrics.RecordSubstitute(substituteCallCount);
+
         try
         {
             if (calloutInterop.Exception is { } ex)
@@ -542,7 +1049,13 @@ internal sealed unsafe class InternalRegex16Bit(string pattern, PcreRegexSetting
 
             switch (result.result_code)
             {
+                case (int)PcreErrorCode.MatchTimeout:
+                case (int)PcreErrorCode.MatchCancelled:
+                    ThrowDeadlineError(result.result_code, settings.Timeout, settings.CancellationToken);
+                    throw new PcreSubstituteException((PcreErrorCode)result.result_code);
+
                 case < 0: // An error occured
+                    Metrics.RecordMatchError(result.result_code);
                     throw new PcreSubstituteException((PcreErrorCode)result.result_code);
 
                 case 0: // No substitution was made, avoid allocating a new string if possible
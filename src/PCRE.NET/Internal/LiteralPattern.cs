@@ -0,0 +1,216 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace PCRE.Internal;
+
+/// <summary>
+/// A pattern which only matches a fixed string, and which is matched with span searches instead of calling into PCRE2.
+/// </summary>
+/// <remarks>
+/// A pattern qualifies when it contains no metacharacter (or is compiled with <see cref="PcreOptions.Literal"/>), optionally after a leading <c>(?i)</c>, and when its options cannot change the meaning of its characters.
+/// Case-insensitive patterns qualify when they only contain ASCII characters, and letters with Unicode case variants outside ASCII (<c>K</c> and <c>S</c>) are excluded in UTF and UCP modes.
+/// The matches fall back to PCRE2 whenever an option or setting would make a difference, such as partial matching, resource limits or callouts.
+/// </remarks>
+internal sealed class LiteralPattern<TChar>
+    where TChar : unmanaged
+{
+    private const PcreOptions _allowedOptions = PcreOptions.IgnoreCase
+                                                | PcreOptions.MultiLine
+                                                | PcreOptions.DotAll
+                                                | PcreOptions.Extended
+                                                | PcreOptions.ExtendedMore
+                                                | PcreOptions.NoAutoCapture
+                                                | PcreOptions.AltBsUX
+                                                | PcreOptions.MatchUnsetBackref
+                                                | PcreOptions.Literal
+                                                | PcreOptions.Ucp
+                                                | PcreOptions.Utf
+                                                | PcreOptions.NoUtfCheck
+                                                | PcreOptions.AltExtendedClass
+                                                | PcreOptions.Ungreedy
+                                                | PcreOptions.DupNames
+                                                | PcreOptions.NoStartOptimize
+                                                | PcreOptions.NoAutoPossess
+                                                | PcreOptions.DollarEndOnly
+                                                | PcreOptions.AltCircumflex
+                                                | PcreOptions.AltVerbNames
+                                                | PcreOptions.AllowEmptyClass
+                                                | PcreOptions.NoDotStarAnchor
+                                                | PcreOptions.NeverUcp
+                                                | PcreOptions.NeverBackslashC
+                                                | PcreOptions.Compiled
+                                                | PcreOptions.CompiledPartial;
+
+    private const uint _allowedMatchOptions = PcreConstants.PCRE2_NOTBOL
+                                              | PcreConstants.PCRE2_NOTEOL
+                                              | PcreConstants.PCRE2_NOTEMPTY
+                                              | PcreConstants.PCRE2_NOTEMPTY_ATSTART
+                                              | PcreConstants.PCRE2_NO_UTF_CHECK
+                                              | PcreConstants.PCRE2_DISABLE_RECURSELOOP_CHECK;
+
+    private readonly TChar[] _value;
+    private readonly TChar[]? _otherCaseValue;
+    private readonly bool _checkUtf;
+
+    private LiteralPattern(TChar[] value, TChar[]? otherCaseValue, bool checkUtf)
+    {
+        _value = value;
+        _otherCaseValue = otherCaseValue;
+        _checkUtf = checkUtf;
+    }
+
+    public int Length => _value.Length;
+
+    public static LiteralPattern<TChar>? TryCreate(ReadOnlySpan<TChar> pattern, PcreRegexSettings settings, int captureCount)
+    {
+        var options = settings.Options;
+
+        if (pattern.IsEmpty
+            || captureCount != 0
+            || (options & ~_allowedOptions) != 0
+            || settings.ExtraCompileOptions != PcreExtraCompileOptions.None)
+        {
+            return null;
+        }
+
+        var isLiteral = (options & PcreOptions.Literal) != 0;
+        var isExtended = (options & (PcreOptions.Extended | PcreOptions.ExtendedMore)) != 0;
+        var isCaseless = (options & PcreOptions.IgnoreCase) != 0;
+        var isUnicode = (options & (PcreOptions.Utf | PcreOptions.Ucp)) != 0;
+
+        var codes = new int[pattern.Length];
+
+        if (typeof(TChar) == typeof(char))
+        {
+            var chars = MemoryMarshal.Cast<TChar, char>(pattern);
+            for (var i = 0; i < codes.Length; ++i)
+                codes[i] = chars[i];
+        }
+        else
+        {
+            var bytes = MemoryMarshal.Cast<TChar, byte>(pattern);
+            for (var i = 0; i < codes.Length; ++i)
+                codes[i] = bytes[i];
+        }
+
+        // A leading (?i) is the usual way of making a literal case-insensitive.
+        var start = 0;
+
+        if (!isLiteral && codes.Length > 4 && codes[0] == '(' && codes[1] == '?' && codes[2] == 'i' && codes[3] == ')')
+        {
+            start = 4;
+            isCaseless = true;
+        }
+
+        codes = codes.AsSpan(start).ToArray();
+
+        var hasLetters = false;
+
+        foreach (var code in codes)
+        {
+            if (!isLiteral && (IsMetaCharacter(code) || isExtended && IsPatternWhiteSpace(code)))
+                return null;
+
+            if (isCaseless)
+            {
+                if (code >= 0x80 || isUnicode && (code | 0x20) is 'k' or 's')
+                    return null;
+
+                hasLetters |= (code | 0x20) is >= 'a' and <= 'z';
+            }
+        }
+
+        var value = pattern.Slice(start).ToArray();
+        var otherCaseValue = default(TChar[]);
+
+        if (hasLetters)
+        {
+            otherCaseValue = new TChar[codes.Length];
+
+            for (var i = 0; i < codes.Length; ++i)
+            {
+                var code = codes[i];
+                if ((code | 0x20) is >= 'a' and <= 'z')
+                    code ^= 0x20;
+
+                if (typeof(TChar) == typeof(char))
+                    MemoryMarshal.Cast<TChar, char>(otherCaseValue.AsSpan())[i] = (char)code;
+                else
+                    MemoryMarshal.Cast<TChar, byte>(otherCaseValue.AsSpan())[i] = (byte)code;
+            }
+        }
+
+        return new LiteralPattern<TChar>(value, otherCaseValue, (options & PcreOptions.Utf) != 0);
+    }
+
+    /// <summary>
+    /// Indicates whether a match with the given arguments can be performed by <see cref="IndexOf"/>.
+    /// </summary>
+    /// <remarks>
+    /// <paramref name="allowedBySettings"/> is <see cref="PcreMatchSettings.AllowsLiteralMatch"/> for the settings of the match.
+    /// In UTF mode, PCRE2 validates the subject unless <c>PCRE2_NO_UTF_CHECK</c> is given. Subjects which are trivially valid are accepted here,
+    /// and the others are left to PCRE2 so it reports the same errors.
+    /// </remarks>
+    public bool CanMatch(ReadOnlySpan<TChar> subject, bool allowedBySettings, int startIndex, uint additionalOptions, Delegate? callout)
+        => (additionalOptions & ~_allowedMatchOptions) == 0
+           && callout is null
+           && (uint)startIndex <= (uint)subject.Length
+           && allowedBySettings
+           && (!_checkUtf || (additionalOptions & PcreConstants.PCRE2_NO_UTF_CHECK) != 0 || InternalRegex<TChar>.IsTriviallyValidUtf(subject));
+
+    /// <summary>
+    /// Returns the index of the first match at or after <paramref name="startIndex"/>, or -1.
+    /// </summary>
+    public int IndexOf(ReadOnlySpan<TChar> subject, int startIndex)
+    {
+        var index = typeof(TChar) == typeof(char)
+            ? IndexOf(MemoryMarshal.Cast<TChar, char>(subject.Slice(startIndex)), MemoryMarshal.Cast<TChar, char>(_value.AsSpan()), MemoryMarshal.Cast<TChar, char>(_otherCaseValue.AsSpan()))
+            : IndexOf(MemoryMarshal.Cast<TChar, byte>(subject.Slice(startIndex)), MemoryMarshal.Cast<TChar, byte>(_value.AsSpan()), MemoryMarshal.Cast<TChar, byte>(_otherCaseValue.AsSpan()));
+
+        return index >= 0 ? startIndex + index : -1;
+    }
+
+    private static int IndexOf<T>(ReadOnlySpan<T> subject, ReadOnlySpan<T> value, ReadOnlySpan<T> otherCaseValue)
+        where T : unmanaged, IEquatable<T>
+    {
+        if (otherCaseValue.IsEmpty)
+            return subject.IndexOf(value);
+
+        // Look for the first character in both cases, then compare the rest of the value.
+        var offset = 0;
+
+        while (subject.Length - offset >= value.Length)
+        {
+            var index = subject.Slice(offset, subject.Length - offset - value.Length + 1).IndexOfAny(value[0], otherCaseValue[0]);
+            if (index < 0)
+                return -1;
+
+            offset += index;
+
+            if (EqualsIgnoreCase(subject.Slice(offset + 1, value.Length - 1), value.Slice(1), otherCaseValue.Slice(1)))
+                return offset;
+
+            ++offset;
+        }
+
+        return -1;
+    }
+
+    private static bool EqualsIgnoreCase<T>(ReadOnlySpan<T> subject, ReadOnlySpan<T> value, ReadOnlySpan<T> otherCaseValue)
+        where T : unmanaged, IEquatable<T>
+    {
+        for (var i = 0; i < value.Length; ++i)
+        {
+            if (!subject[i].Equals(value[i]) && !subject[i].Equals(otherCaseValue[i]))
+                return false;
+        }
+
+        return true;
+    }
+
+    private static bool IsMetaCharacter(int code)
+        => code is '\\' or '^' or '$' or '.' or '[' or '|' or '(' or ')' or '?' or '*' or '+' or '{';
+
+    private static bool IsPatternWhiteSpace(int code)
+        => code is ' ' or '\t' or '\n' or '\v' or '\f' or '\r' or '#' or 0x85 or 0x200E or 0x200F or 0x2028 or 0x2029;
+}
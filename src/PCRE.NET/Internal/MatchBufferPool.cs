@@ -0,0 +1,78 @@
+﻿using System;
+using System.Threading;
+
+namespace PCRE.Internal;
+
+internal static class MatchBufferPool
+{
+    // States of a match buffer, which make sure a rented buffer is only returned once
+    public const int NotPooled = 0;
+    public const int Rented = 1;
+    public const int Returned = 2;
+}
+
+/// <summary>
+/// A pool of match buffers for a given pattern, holding at most one buffer per processor.
+/// </summary>
+/// <remarks>
+/// Each caller starts looking for a buffer in the slot of its current processor, so concurrent callers running on different cores
+/// seldom contend for the same slot. Buffers which do not fit in the pool when returned are disposed.
+/// </remarks>
+internal sealed class MatchBufferPool<TBuffer>(Func<TBuffer> factory)
+    where TBuffer : class, IPcreMatchBuffer, IDisposable
+{
+    private const int _maxProbeCount = 4;
+
+    private readonly TBuffer?[] _slots = new TBuffer?[Math.Max(1, Environment.ProcessorCount)];
+
+    public TBuffer Rent()
+    {
+        var index = GetSlotIndex();
+        var probeCount = Math.Min(_maxProbeCount, _slots.Length);
+
+        for (var i = 0; i < probeCount; ++i)
+        {
+            var buffer = Interlocked.Exchange(ref _slots[(index + i) % _slots.Length], null);
+            if (buffer is not null)
+            {
+                Interlocked.Exchange(ref buffer.PoolState, MatchBufferPool.Rented);
+                return buffer;
+            }
+        }
+
+        var newBuffer = factory();
+        newBuffer.PoolState = MatchBufferPool.Rented;
+        return newBuffer;
+    }
+
+    public void Return(TBuffer buffer)
+    {
+        // A buffer returned twice would end up in two slots, and could then be rented by two threads at once.
+        if (Interlocked.CompareExchange(ref buffer.PoolState, MatchBufferPool.Returned, MatchBufferPool.Rented) != MatchBufferPool.Rented)
+            throw new InvalidOperationException("The match buffer has already been returned.");
+
+        if (buffer.NativeBuffer == IntPtr.Zero)
+            return;
+
+        var index = GetSlotIndex();
+        var probeCount = Math.Min(_maxProbeCount, _slots.Length);
+
+        for (var i = 0; i < probeCount; ++i)
+        {
+            if (Interlocked.CompareExchange(ref _slots[(index + i) % _slots.Length], buffer, null) is null)
+                return;
+        }
+
+        buffer.Dispose();
+    }
+
+    private int GetSlotIndex()
+    {
+#if NETCOREAPP3_0_OR_GREATER
+        var id = Thread.GetCurrentProcessorId();
+#else
+        var id = Environment.CurrentManagedThreadId;
+#endif
+        return (int)((uint)id % (uint)_slots.Length);
+    }
+}
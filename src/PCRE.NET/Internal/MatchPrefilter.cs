@@ -0,0 +1,247 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+#if NET8_0_OR_GREATER
+using System.Buffers;
+using System.Collections.Generic;
+#endif
+
+namespace PCRE.Internal;
+
+/// <summary>
+/// Rejects subjects which cannot match before calling into native code, using the start-of-match data of a compiled pattern.
+/// </summary>
+/// <remarks>
+/// This performs the checks of the native prefilter which runs before <c>pcre2_match</c> (first code unit or start bitmap, minimum length and required code unit),
+/// but saves the transition to native code when most subjects don't match, which is the common case when filtering short strings.
+/// Any case which could make a difference, such as partial matching, limits or diagnostics, is left to native code.
+/// </remarks>
+internal sealed class MatchPrefilter<TChar>
+    where TChar : unmanaged
+{
+    private const uint _enabledFlag = 0x01;
+    private const uint _firstCodeUnitFlag = 0x02;
+    private const uint _startBitmapFlag = 0x04;
+    private const uint _lastCodeUnitFlag = 0x08;
+    private const uint _canAdvanceFlag = 0x10;
+    private const uint _checkUtfFlag = 0x20;
+
+    private const uint _allowedMatchOptions = PcreConstants.PCRE2_NOTBOL
+                                              | PcreConstants.PCRE2_NOTEOL
+                                              | PcreConstants.PCRE2_NOTEMPTY
+                                              | PcreConstants.PCRE2_NOTEMPTY_ATSTART
+                                              | PcreConstants.PCRE2_NO_UTF_CHECK
+                                              | PcreConstants.PCRE2_NO_JIT
+                                              | PcreConstants.PCRE2_ENDANCHORED
+                                              | PcreConstants.PCRE2_COPY_MATCHED_SUBJECT
+                                              | PcreConstants.PCRE2_DISABLE_RECURSELOOP_CHECK;
+
+    private const uint _jitMatchOptions = PcreConstants.PCRE2_NOTBOL
+                                          | PcreConstants.PCRE2_NOTEOL
+                                          | PcreConstants.PCRE2_NOTEMPTY
+                                          | PcreConstants.PCRE2_NOTEMPTY_ATSTART
+                                          | PcreConstants.PCRE2_NO_UTF_CHECK
+                                          | PcreConstants.PCRE2_COPY_MATCHED_SUBJECT;
+
+    private readonly uint _flags;
+    private readonly int _minLength;
+    private readonly char _firstCodeUnit;
+    private readonly char _firstCodeUnit2;
+    private readonly char _lastCodeUnit;
+    private readonly char _lastCodeUnit2;
+    private readonly byte[]? _startBitmap;
+
+#if NET8_0_OR_GREATER
+    private readonly SearchValues<char>? _startChars;
+    private readonly SearchValues<byte>? _startBytes;
+    private readonly bool _startCharsInverted;
+#endif
+
+    private unsafe MatchPrefilter(in Native.prefilter_info info)
+    {
+        _flags = info.flags;
+        _minLength = (int)info.min_length;
+        _firstCodeUnit = (char)info.first_code_unit;
+        _firstCodeUnit2 = (char)info.first_code_unit2;
+        _lastCodeUnit = (char)info.last_code_unit;
+        _lastCodeUnit2 = (char)info.last_code_unit2;
+
+        if ((_flags & _startBitmapFlag) == 0)
+            return;
+
+        fixed (byte* pBitmap = info.start_bitmap)
+            _startBitmap = new ReadOnlySpan<byte>(pBitmap, 32).ToArray();
+
+#if NET8_0_OR_GREATER
+        if (typeof(TChar) == typeof(byte))
+        {
+            _startBytes = SearchValues.Create(GetStartCodeUnits(true).ConvertAll(i => (byte)i).ToArray());
+        }
+        else
+        {
+            // In the 16-bit library, the last bit of the bitmap stands for all the code units above 254,
+            // which are found by searching for anything but the code units below 255 which are not in the bitmap.
+            _startCharsInverted = IsInStartBitmap(255);
+            _startChars = SearchValues.Create(GetStartCodeUnits(!_startCharsInverted).ConvertAll(i => (char)i).ToArray());
+        }
+#endif
+    }
+
+    public static unsafe MatchPrefilter<TChar>? Create(in Native.prefilter_info info)
+    {
+        if ((info.flags & _enabledFlag) == 0)
+            return null;
+
+        // Without any of these, the prefilter could never reject a subject.
+        if ((info.flags & (_firstCodeUnitFlag | _startBitmapFlag | _lastCodeUnitFlag)) == 0 && info.min_length == 0)
+            return null;
+
+        return new MatchPrefilter<TChar>(info);
+    }
+
+    /// <summary>
+    /// Returns <see langword="true"/> if the subject cannot match from <paramref name="startIndex"/>.
+    /// </summary>
+    /// <remarks>
+    /// Otherwise, <paramref name="startIndex"/> may be advanced to the first position where a match can start when this doesn't change the result,
+    /// and <c>PCRE2_NO_UTF_CHECK</c> is added to <paramref name="additionalOptions"/> once the subject is known to be valid.
+    /// As in native code, the required code unit search and the start index advance are skipped when the JIT is used, since it performs them itself.
+    /// <paramref name="allowedBySettings"/> is <see cref="PcreMatchSettings.AllowsPrefilter"/> for the settings of the match.
+    /// </remarks>
+    public bool RejectsMatch(ReadOnlySpan<TChar> subject, bool allowedBySettings, ref int startIndex, ref uint additionalOptions, bool isJitCompiled)
+    {
+        if ((additionalOptions & ~_allowedMatchOptions) != 0
+            || (uint)startIndex > (uint)subject.Length
+            || !allowedBySettings)
+        {
+            return false;
+        }
+
+        var useJit = isJitCompiled && (additionalOptions & ~_jitMatchOptions) == 0;
+        var checkUtf = (_flags & _checkUtfFlag) != 0;
+
+        if (checkUtf && (additionalOptions & PcreConstants.PCRE2_NO_UTF_CHECK) == 0)
+        {
+            // Invalid subjects are left to PCRE2, so it reports the same errors.
+            if (!InternalRegex<TChar>.IsTriviallyValidUtf(subject))
+                return false;
+
+            additionalOptions |= PcreConstants.PCRE2_NO_UTF_CHECK;
+        }
+
+        var candidate = startIndex;
+
+        if ((_flags & _firstCodeUnitFlag) != 0)
+        {
+            var index = IndexOfAny(subject.Slice(startIndex), _firstCodeUnit, _firstCodeUnit2);
+            if (index < 0)
+                return true;
+
+            candidate += index;
+        }
+        else if ((_flags & _startBitmapFlag) != 0)
+        {
+            var index = IndexOfStartCodeUnit(subject.Slice(startIndex));
+            if (index < 0)
+                return true;
+
+            candidate += index;
+        }
+
+        if (subject.Length - candidate < _minLength)
+            return true;
+
+        if (useJit)
+            return false;
+
+        if ((_flags & _lastCodeUnitFlag) != 0)
+        {
+            // The required code unit needs to follow the first one, when it is set
+            var offset = candidate + ((_flags & _firstCodeUnitFlag) != 0 ? 1 : 0);
+            if (IndexOfAny(subject.Slice(offset), _lastCodeUnit, _lastCodeUnit2) < 0)
+                return true;
+        }
+
+        if (candidate != startIndex
+            && (_flags & _canAdvanceFlag) != 0
+            && (additionalOptions & PcreConstants.PCRE2_NOTEMPTY_ATSTART) == 0
+            && (!checkUtf || IsFirstCodeUnit(subject, candidate)))
+        {
+            startIndex = candidate;
+        }
+
+        return false;
+    }
+
+    private static int IndexOfAny(ReadOnlySpan<TChar> subject, char value, char value2)
+    {
+        if (typeof(TChar) == typeof(char))
+        {
+            var chars = MemoryMarshal.Cast<TChar, char>(subject);
+            return value == value2 ? chars.IndexOf(value) : chars.IndexOfAny(value, value2);
+        }
+
+        var bytes = MemoryMarshal.Cast<TChar, byte>(subject);
+        return value == value2 ? bytes.IndexOf((byte)value) : bytes.IndexOfAny((byte)value, (byte)value2);
+    }
+
+    private int IndexOfStartCodeUnit(ReadOnlySpan<TChar> subject)
+    {
+#if NET8_0_OR_GREATER
+        if (typeof(TChar) == typeof(char))
+        {
+            var chars = MemoryMarshal.Cast<TChar, char>(subject);
+            return _startCharsInverted ? chars.IndexOfAnyExcept(_startChars!) : chars.IndexOfAny(_startChars!);
+        }
+
+        return MemoryMarshal.Cast<TChar, byte>(subject).IndexOfAny(_startBytes!);
+#else
+        if (typeof(TChar) == typeof(char))
+        {
+            var chars = MemoryMarshal.Cast<TChar, char>(subject);
+
+            for (var i = 0; i < chars.Length; ++i)
+            {
+                if (IsInStartBitmap(Math.Min(chars[i], 255)))
+                    return i;
+            }
+
+            return -1;
+        }
+
+        var bytes = MemoryMarshal.Cast<TChar, byte>(subject);
+
+        for (var i = 0; i < bytes.Length; ++i)
+        {
+            if (IsInStartBitmap(bytes[i]))
+                return i;
+        }
+
+        return -1;
+#endif
+    }
+
+    private bool IsInStartBitmap(int codeUnit)
+        => (_startBitmap![codeUnit >> 3] & (1 << (codeUnit & 7))) != 0;
+
+#if NET8_0_OR_GREATER
+    private List<int> GetStartCodeUnits(bool inBitmap)
+    {
+        var result = new List<int>();
+        var count = typeof(TChar) == typeof(byte) ? 256 : 255;
+
+        for (var codeUnit = 0; codeUnit < count; ++codeUnit)
+        {
+            if (IsInStartBitmap(codeUnit) == inBitmap)
+                result.Add(codeUnit);
+        }
+
+        return result;
+    }
+#endif
+
+    private static bool IsFirstCodeUnit(ReadOnlySpan<TChar> subject, int index)
+        => typeof(TChar) == typeof(char)
+            ? !char.IsLowSurrogate(MemoryMarshal.Cast<TChar, char>(subject)[index])
+            : (MemoryMarshal.Cast<TChar, byte>(subject)[index] & 0xc0) != 0x80;
+}
@@ -0,0 +1,164 @@
+﻿using System.Diagnostics;
+#if NET6_0_OR_GREATER
+using System.Collections.Generic;
+using System.Diagnostics.Metrics;
+#endif
+
+namespace PCRE.Internal;
+
+/// <summary>
+/// Records the measurements published by the <c>PCRE.NET</c> meter and event source.
+/// </summary>
+/// <remarks>
+/// Each measurement checks whether a listener is attached before doing any work.
+/// The meter is only available on .NET 6 and later, and the event counters on .NET Core 3.0 and later.
+/// </remarks>
+internal static class Metrics
+{
+    public const string Name = "PCRE.NET";
+
+#if NET6_0_OR_GREATER
+    private static readonly Meter _meter = new(Name, typeof(Metrics).Assembly.GetName().Version?.ToString());
+
+    private static readonly Counter<long> _compileCount = _meter.CreateCounter<long>("pcre.compile.count", "{pattern}", "Number of compiled patterns.");
+    private static readonly Histogram<double> _compileDuration = _meter.CreateHistogram<double>("pcre.compile.duration", "s", "Duration of pattern compilation, including JIT compilation.");
+    private static readonly Histogram<double> _jitCompileDuration = _meter.CreateHistogram<double>("pcre.jit.compile.duration", "s", "Duration of JIT compilation.");
+    private static readonly Counter<long> _jitCompileFailures = _meter.CreateCounter<long>("pcre.jit.compile.failures", "{pattern}", "Number of patterns which could not be JIT-compiled.");
+    private static readonly Counter<long> _cacheLookups = _meter.CreateCounter<long>("pcre.cache.lookups", "{lookup}", "Number of lookups in the cache of compiled patterns.");
+    private static readonly Counter<long> _cacheEvictions = _meter.CreateCounter<long>("pcre.cache.evictions", "{pattern}", "Number of patterns evicted from the cache of compiled patterns.");
+    private static readonly Counter<long> _matchCount = _meter.CreateCounter<long>("pcre.match.count", "{call}", "Number of match calls, by matching engine.");
+    private static readonly Counter<long> _matchErrors = _meter.CreateCounter<long>("pcre.match.errors", "{error}", "Number of matches which exceeded a resource limit.");
+    private static readonly Counter<long> _substituteRetries = _meter.CreateCounter<long>("pcre.substitute.retries", "{pass}", "Number of additional substitution passes caused by a too small output buffer.");
+
+    private static readonly KeyValuePair<string, object?> _cacheHitTag = new("pcre.cache.result", "hit");
+    private static readonly KeyValuePair<string, object?> _cacheMissTag = new("pcre.cache.result", "miss");
+#endif
+
+    public static bool IsCompileEnabled
+        => PcreEventSource.Log.IsEnabled()
+#if NET6_0_OR_GREATER
+           || _compileCount.Enabled
+           || _compileDuration.Enabled
+           || _jitCompileDuration.Enabled
+           || _jitCompileFailures.Enabled
+#endif
+    ;
+
+    public static long GetCompileTimestamp()
+        => IsCompileEnabled ? Stopwatch.GetTimestamp() : 0;
+
+    public static void RecordCompile(long startTimestamp, bool jitRequested, int jitErrorCode, ulong jitDurationNanoseconds)
+    {
+        if (startTimestamp == 0)
+            return;
+
+        var duration = (double)(Stopwatch.GetTimestamp() - startTimestamp) / Stopwatch.Frequency;
+        var jitDuration = jitDurationNanoseconds / 1e9;
+        var jitFailed = jitRequested && jitErrorCode != 0;
+
+#if NET6_0_OR_GREATER
+        _compileCount.Add(1);
+        _compileDuration.Record(duration);
+
+        if (jitRequested)
+        {
+            _jitCompileDuration.Record(jitDuration);
+
+            if (jitFailed)
+                _jitCompileFailures.Add(1);
+        }
+#endif
+
+        if (PcreEventSource.Log.IsEnabled())
+            PcreEventSource.Log.RecordCompile(duration, jitRequested ? jitDuration : null, jitFailed);
+    }
+
+    public static void RecordCacheLookup(bool hit)
+    {
+#if NET6_0_OR_GREATER
+        if (_cacheLookups.Enabled)
+            _cacheLookups.Add(1, hit ? _cacheHitTag : _cacheMissTag);
+#endif
+
+        if (PcreEventSource.Log.IsEnabled())
+            PcreEventSource.Log.RecordCacheLookup(hit);
+    }
+
+    public static void RecordCacheEviction()
+    {
+#if NET6_0_OR_GREATER
+        if (_cacheEvictions.Enabled)
+            _cacheEvictions.Add(1);
+#endif
+
+        if (PcreEventSource.Log.IsEnabled())
+            PcreEventSource.Log.RecordCacheEviction();
+    }
+
+    public static void RecordMatch(MatchEngine engine)
+    {
+#if NET6_0_OR_GREATER
+        if (_matchCount.Enabled)
+            _matchCount.Add(1, new KeyValuePair<string, object?>("pcre.engine", GetEngineName(engine)));
+#endif
+
+        if (PcreEventSource.Log.IsEnabled())
+            PcreEventSource.Log.RecordMatch(engine);
+    }
+
+    public static void RecordMatchError(int resultCode)
+    {
+        var errorType = resultCode switch
+        {
+            PcreConstants.PCRE2_ERROR_MATCHLIMIT     => "match_limit",
+            PcreConstants.PCRE2_ERROR_DEPTHLIMIT     => "depth_limit",
+            PcreConstants.PCRE2_ERROR_HEAPLIMIT      => "heap_limit",
+            PcreConstants.PCRE2_ERROR_JIT_STACKLIMIT => "jit_stack_limit",
+            _                                        => null
+        };
+
+        if (errorType is null)
+            return;
+
+#if NET6_0_OR_GREATER
+        if (_matchErrors.Enabled)
+            _matchErrors.Add(1, new KeyValuePair<string, object?>("error.type", errorType));
+#endif
+
+        if (PcreEventSource.Log.IsEnabled())
+            PcreEventSource.Log.RecordMatchError(resultCode == PcreConstants.PCRE2_ERROR_JIT_STACKLIMIT);
+    }
+
+    public static void RecordSubstitute(uint substituteCallCount)
+    {
+        if (substituteCallCount <= 1)
+            return;
+
+#if NET6_0_OR_GREATER
+        if (_substituteRetries.Enabled)
+            _substituteRetries.Add(substituteCallCount - 1);
+#endif
+
+        if (PcreEventSource.Log.IsEnabled())
+            PcreEventSource.Log.RecordSubstituteRetries(substituteCallCount - 1);
+    }
+
+#if NET6_0_OR_GREATER
+    private static string GetEngineName(MatchEngine engine)
+        => engine switch
+        {
+            MatchEngine.Jit     => "jit",
+            MatchEngine.Dfa     => "dfa",
+            MatchEngine.Literal => "literal",
+            _                   => "interpreter"
+        };
+#endif
+
+    public enum MatchEngine
+    {
+        Interpreter,
+        Jit,
+        Dfa,
+        Literal
+    }
+}
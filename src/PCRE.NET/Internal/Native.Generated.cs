@@ -18,6 +18,8 @@ internal unsafe partial interface INative
     int get_error_message(int errorCode, void* errorBuffer, uint bufferSize);
     void compile(Native.compile_input* input, Native.compile_result* result);
     void code_free(void* code);
+    int serialize_code(void* code, byte** bytes, uint* size);
+    void serialize_code_free(byte* bytes);
     int pattern_info(void* code, uint key, void* data);
     int config(uint key, void* data);
     void match(Native.match_input* input, Native.match_result* result);
@@ -29,10 +31,19 @@ internal unsafe partial interface INative
     void free_match_buffer(void* buffer);
     uint get_callout_count(void* code);
     void get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
+    void get_prefilter_info(void* code, Native.prefilter_info* info);
     void* jit_stack_create(uint startSize, uint maxSize);
     void jit_stack_free(void* stack);
+    void jit_memory_get_stats(Native.jit_memory_stats* stats);
+    void jit_memory_set_huge_pages(int enabled);
+    int jit_memory_enable_custom_allocator();
+    void jit_memory_trim();
+    uint jit_profiling_get_supported_flags();
+    uint jit_profiling_get_flags();
+    void jit_profiling_set_flags(uint flags);
     int convert(Native.convert_input* input, Native.convert_result* result);
     void convert_result_free(void* str);
+    int valid_utf(void* subject, uint length, uint* errorOffset);
 }
 
 internal readonly unsafe partial struct Native8Bit : INative
@@ -58,6 +69,18 @@ internal readonly unsafe partial struct Native8Bit : INative
     [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
     private static extern void pcrenet_code_free(void* code);
 
+    public readonly int serialize_code(void* code, byte** bytes, uint* size)
+        => pcrenet_serialize_code(code, bytes, size);
+
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_serialize_code_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+    public readonly void serialize_code_free(byte* bytes)
+        => pcrenet_serialize_code_free(bytes);
+
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_serialize_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_serialize_code_free(byte* bytes);
+
     public readonly int pattern_info(void* code, uint key, void* data)
         => pcrenet_pattern_info(code, key, data);
 
@@ -128,6 +151,13 @@ internal readonly unsafe partial struct Native8Bit : INative
     [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_get_callouts_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
     private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+    public readonly void get_prefilter_info(void* code, Native.prefilter_info* info)
+        => pcrenet_get_prefilter_info(code, info);
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_get_prefilter_info_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
     public readonly void* jit_stack_create(uint startSize, uint maxSize)
         => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -140,6 +170,54 @@ internal readonly unsafe partial struct Native8Bit : INative
     [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_stack_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
     private static extern void pcrenet_jit_stack_free(void* stack);
 
+    public readonly void jit_memory_get_stats(Native.jit_memory_stats* stats)
+        => pcrenet_jit_memory_get_stats(stats);
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_memory_get_stats_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+    public readonly void jit_memory_set_huge_pages(int enabled)
+        => pcrenet_jit_memory_set_huge_pages(enabled);
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_memory_set_huge_pages_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+    public readonly int jit_memory_enable_custom_allocator()
+        => pcrenet_jit_memory_enable_custom_allocator();
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+    public readonly void jit_memory_trim()
+        => pcrenet_jit_memory_trim();
+
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_memory_trim_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_jit_memory_trim();
+
+    public readonly uint jit_profiling_get_supported_flags()
+        => pcrenet_jit_profiling_get_supported_flags();
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+    public readonly uint jit_profiling_get_flags()
+        => pcrenet_jit_profiling_get_flags();
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_profiling_get_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern uint pcrenet_jit_profiling_get_flags();
+
+    public readonly void jit_profiling_set_flags(uint flags)
+        => pcrenet_jit_profiling_set_flags(flags);
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_profiling_set_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
     public readonly int convert(Native.convert_input* input, Native.convert_result* result)
         => pcrenet_convert(input, result);
 
@@ -152,6 +230,12 @@ internal readonly unsafe partial struct Native8Bit : INative
     [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_convert_result_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
     private static extern void pcrenet_convert_result_free(void* str);
 
+    public readonly int valid_utf(void* subject, uint length, uint* errorOffset)
+        => pcrenet_valid_utf(subject, length, errorOffset);
+
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_valid_utf_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
 #else
 
     private static readonly Lib _lib = GetLib();
@@ -165,6 +249,12 @@ internal readonly unsafe partial struct Native8Bit : INative
     public readonly void code_free(void* code)
         => _lib.code_free(code);
 
+    public readonly int serialize_code(void* code, byte** bytes, uint* size)
+        => _lib.serialize_code(code, bytes, size);
+
+    public readonly void serialize_code_free(byte* bytes)
+        => _lib.serialize_code_free(bytes);
+
     public readonly int pattern_info(void* code, uint key, void* data)
         => _lib.pattern_info(code, key, data);
 
@@ -198,18 +288,45 @@ internal readonly unsafe partial struct Native8Bit : INative
     public readonly void get_callouts(void* code, Native.pcre2_callout_enumerate_block* data)
         => _lib.get_callouts(code, data);
 
+    public readonly void get_prefilter_info(void* code, Native.prefilter_info* info)
+        => _lib.get_prefilter_info(code, info);
+
     public readonly void* jit_stack_create(uint startSize, uint maxSize)
         => _lib.jit_stack_create(startSize, maxSize);
 
     public readonly void jit_stack_free(void* stack)
         => _lib.jit_stack_free(stack);
 
+    public readonly void jit_memory_get_stats(Native.jit_memory_stats* stats)
+        => _lib.jit_memory_get_stats(stats);
+
+    public readonly void jit_memory_set_huge_pages(int enabled)
+        => _lib.jit_memory_set_huge_pages(enabled);
+
+    public readonly int jit_memory_enable_custom_allocator()
+        => _lib.jit_memory_enable_custom_allocator();
+
+    public readonly void jit_memory_trim()
+        => _lib.jit_memory_trim();
+
+    public readonly uint jit_profiling_get_supported_flags()
+        => _lib.jit_profiling_get_supported_flags();
+
+    public readonly uint jit_profiling_get_flags()
+        => _lib.jit_profiling_get_flags();
+
+    public readonly void jit_profiling_set_flags(uint flags)
+        => _lib.jit_profiling_set_flags(flags);
+
     public readonly int convert(Native.convert_input* input, Native.convert_result* result)
         => _lib.convert(input, result);
 
     public readonly void convert_result_free(void* str)
         => _lib.convert_result_free(str);
 
+    public readonly int valid_utf(void* subject, uint length, uint* errorOffset)
+        => _lib.valid_utf(subject, length, errorOffset);
+
     private static Lib GetLib()
     {
         try
@@ -239,6 +356,8 @@ internal readonly unsafe partial struct Native8Bit : INative
         public abstract int get_error_message(int errorCode, void* errorBuffer, uint bufferSize);
         public abstract void compile(Native.compile_input* input, Native.compile_result* result);
         public abstract void code_free(void* code);
+        public abstract int serialize_code(void* code, byte** bytes, uint* size);
+        public abstract void serialize_code_free(byte* bytes);
         public abstract int pattern_info(void* code, uint key, void* data);
         public abstract int config(uint key, void* data);
         public abstract void match(Native.match_input* input, Native.match_result* result);
@@ -250,10 +369,19 @@ internal readonly unsafe partial struct Native8Bit : INative
         public abstract void free_match_buffer(void* buffer);
         public abstract uint get_callout_count(void* code);
         public abstract void get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
+        public abstract void get_prefilter_info(void* code, Native.prefilter_info* info);
         public abstract void* jit_stack_create(uint startSize, uint maxSize);
         public abstract void jit_stack_free(void* stack);
+        public abstract void jit_memory_get_stats(Native.jit_memory_stats* stats);
+        public abstract void jit_memory_set_huge_pages(int enabled);
+        public abstract int jit_memory_enable_custom_allocator();
+        public abstract void jit_memory_trim();
+        public abstract uint jit_profiling_get_supported_flags();
+        public abstract uint jit_profiling_get_flags();
+        public abstract void jit_profiling_set_flags(uint flags);
         public abstract int convert(Native.convert_input* input, Native.convert_result* result);
         public abstract void convert_result_free(void* str);
+        public abstract int valid_utf(void* subject, uint length, uint* errorOffset);
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -277,6 +405,18 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_serialize_code_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_serialize_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -343,6 +483,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_get_callouts_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_get_prefilter_info_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -355,6 +501,48 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_stack_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_memory_get_stats_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_memory_set_huge_pages_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_memory_trim_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_profiling_get_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_profiling_set_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -367,6 +555,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_convert_result_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_valid_utf_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -390,6 +584,18 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_serialize_code_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_serialize_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -456,6 +662,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_get_callouts_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_get_prefilter_info_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -468,6 +680,48 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_stack_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_memory_get_stats_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_memory_set_huge_pages_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_memory_trim_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_profiling_get_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_profiling_set_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -480,6 +734,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_convert_result_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_valid_utf_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -503,6 +763,18 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_serialize_code_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_serialize_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -569,6 +841,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_get_callouts_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_get_prefilter_info_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -581,6 +859,48 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_stack_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_memory_get_stats_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_memory_set_huge_pages_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_memory_trim_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_profiling_get_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_profiling_set_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -593,6 +913,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_convert_result_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_valid_utf_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -616,6 +942,18 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_serialize_code_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_serialize_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -682,6 +1020,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_get_callouts_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_get_prefilter_info_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -694,6 +1038,48 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_stack_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_memory_get_stats_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_memory_set_huge_pages_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_memory_trim_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_profiling_get_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_profiling_set_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -706,6 +1092,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_convert_result_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_valid_utf_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -729,6 +1121,18 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_serialize_code_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_serialize_code_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -795,6 +1199,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_get_callouts_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_get_prefilter_info_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -807,6 +1217,48 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_stack_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_memory_get_stats_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_memory_set_huge_pages_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_memory_trim_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_profiling_get_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_profiling_set_flags_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -819,6 +1271,12 @@ internal readonly unsafe partial struct Native8Bit : INative
         [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_convert_result_free_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_valid_utf_8", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
 #endif
@@ -847,6 +1305,18 @@ internal readonly unsafe partial struct Native16Bit : INative
     [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
     private static extern void pcrenet_code_free(void* code);
 
+    public readonly int serialize_code(void* code, byte** bytes, uint* size)
+        => pcrenet_serialize_code(code, bytes, size);
+
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_serialize_code_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+    public readonly void serialize_code_free(byte* bytes)
+        => pcrenet_serialize_code_free(bytes);
+
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_serialize_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_serialize_code_free(byte* bytes);
+
     public readonly int pattern_info(void* code, uint key, void* data)
         => pcrenet_pattern_info(code, key, data);
 
@@ -917,6 +1387,13 @@ internal readonly unsafe partial struct Native16Bit : INative
     [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_get_callouts_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
     private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+    public readonly void get_prefilter_info(void* code, Native.prefilter_info* info)
+        => pcrenet_get_prefilter_info(code, info);
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_get_prefilter_info_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
     public readonly void* jit_stack_create(uint startSize, uint maxSize)
         => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -929,6 +1406,54 @@ internal readonly unsafe partial struct Native16Bit : INative
     [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_stack_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
     private static extern void pcrenet_jit_stack_free(void* stack);
 
+    public readonly void jit_memory_get_stats(Native.jit_memory_stats* stats)
+        => pcrenet_jit_memory_get_stats(stats);
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_memory_get_stats_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+    public readonly void jit_memory_set_huge_pages(int enabled)
+        => pcrenet_jit_memory_set_huge_pages(enabled);
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_memory_set_huge_pages_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+    public readonly int jit_memory_enable_custom_allocator()
+        => pcrenet_jit_memory_enable_custom_allocator();
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+    public readonly void jit_memory_trim()
+        => pcrenet_jit_memory_trim();
+
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_memory_trim_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_jit_memory_trim();
+
+    public readonly uint jit_profiling_get_supported_flags()
+        => pcrenet_jit_profiling_get_supported_flags();
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+    public readonly uint jit_profiling_get_flags()
+        => pcrenet_jit_profiling_get_flags();
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_profiling_get_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern uint pcrenet_jit_profiling_get_flags();
+
+    public readonly void jit_profiling_set_flags(uint flags)
+        => pcrenet_jit_profiling_set_flags(flags);
+
+    [SuppressGCTransition]
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_jit_profiling_set_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
     public readonly int convert(Native.convert_input* input, Native.convert_result* result)
         => pcrenet_convert(input, result);
 
@@ -941,6 +1466,12 @@ internal readonly unsafe partial struct Native16Bit : INative
     [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_convert_result_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
     private static extern void pcrenet_convert_result_free(void* str);
 
+    public readonly int valid_utf(void* subject, uint length, uint* errorOffset)
+        => pcrenet_valid_utf(subject, length, errorOffset);
+
+    [DllImport("PCRE.NET.Native", EntryPoint = "pcrenet_valid_utf_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+    private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
 #else
 
     private static readonly Lib _lib = GetLib();
@@ -954,6 +1485,12 @@ internal readonly unsafe partial struct Native16Bit : INative
     public readonly void code_free(void* code)
         => _lib.code_free(code);
 
+    public readonly int serialize_code(void* code, byte** bytes, uint* size)
+        => _lib.serialize_code(code, bytes, size);
+
+    public readonly void serialize_code_free(byte* bytes)
+        => _lib.serialize_code_free(bytes);
+
     public readonly int pattern_info(void* code, uint key, void* data)
         => _lib.pattern_info(code, key, data);
 
@@ -987,18 +1524,45 @@ internal readonly unsafe partial struct Native16Bit : INative
     public readonly void get_callouts(void* code, Native.pcre2_callout_enumerate_block* data)
         => _lib.get_callouts(code, data);
 
+    public readonly void get_prefilter_info(void* code, Native.prefilter_info* info)
+        => _lib.get_prefilter_info(code, info);
+
     public readonly void* jit_stack_create(uint startSize, uint maxSize)
         => _lib.jit_stack_create(startSize, maxSize);
 
     public readonly void jit_stack_free(void* stack)
         => _lib.jit_stack_free(stack);
 
+    public readonly void jit_memory_get_stats(Native.jit_memory_stats* stats)
+        => _lib.jit_memory_get_stats(stats);
+
+    public readonly void jit_memory_set_huge_pages(int enabled)
+        => _lib.jit_memory_set_huge_pages(enabled);
+
+    public readonly int jit_memory_enable_custom_allocator()
+        => _lib.jit_memory_enable_custom_allocator();
+
+    public readonly void jit_memory_trim()
+        => _lib.jit_memory_trim();
+
+    public readonly uint jit_profiling_get_supported_flags()
+        => _lib.jit_profiling_get_supported_flags();
+
+    public readonly uint jit_profiling_get_flags()
+        => _lib.jit_profiling_get_flags();
+
+    public readonly void jit_profiling_set_flags(uint flags)
+        => _lib.jit_profiling_set_flags(flags);
+
     public readonly int convert(Native.convert_input* input, Native.convert_result* result)
         => _lib.convert(input, result);
 
     public readonly void convert_result_free(void* str)
         => _lib.convert_result_free(str);
 
+    public readonly int valid_utf(void* subject, uint length, uint* errorOffset)
+        => _lib.valid_utf(subject, length, errorOffset);
+
     private static Lib GetLib()
     {
         try
@@ -1028,6 +1592,8 @@ internal readonly unsafe partial struct Native16Bit : INative
         public abstract int get_error_message(int errorCode, void* errorBuffer, uint bufferSize);
         public abstract void compile(Native.compile_input* input, Native.compile_result* result);
         public abstract void code_free(void* code);
+        public abstract int serialize_code(void* code, byte** bytes, uint* size);
+        public abstract void serialize_code_free(byte* bytes);
         public abstract int pattern_info(void* code, uint key, void* data);
         public abstract int config(uint key, void* data);
         public abstract void match(Native.match_input* input, Native.match_result* result);
@@ -1039,10 +1605,19 @@ internal readonly unsafe partial struct Native16Bit : INative
         public abstract void free_match_buffer(void* buffer);
         public abstract uint get_callout_count(void* code);
         public abstract void get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
+        public abstract void get_prefilter_info(void* code, Native.prefilter_info* info);
         public abstract void* jit_stack_create(uint startSize, uint maxSize);
         public abstract void jit_stack_free(void* stack);
+        public abstract void jit_memory_get_stats(Native.jit_memory_stats* stats);
+        public abstract void jit_memory_set_huge_pages(int enabled);
+        public abstract int jit_memory_enable_custom_allocator();
+        public abstract void jit_memory_trim();
+        public abstract uint jit_profiling_get_supported_flags();
+        public abstract uint jit_profiling_get_flags();
+        public abstract void jit_profiling_set_flags(uint flags);
         public abstract int convert(Native.convert_input* input, Native.convert_result* result);
         public abstract void convert_result_free(void* str);
+        public abstract int valid_utf(void* subject, uint length, uint* errorOffset);
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -1066,6 +1641,18 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_serialize_code_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_serialize_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -1132,6 +1719,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_get_callouts_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_get_prefilter_info_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -1144,6 +1737,48 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_stack_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_memory_get_stats_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_memory_set_huge_pages_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_memory_trim_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_profiling_get_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_jit_profiling_set_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -1156,6 +1791,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_convert_result_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.dll", EntryPoint = "pcrenet_valid_utf_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -1179,6 +1820,18 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_serialize_code_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_serialize_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -1245,6 +1898,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_get_callouts_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_get_prefilter_info_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -1257,6 +1916,48 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_stack_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_memory_get_stats_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_memory_set_huge_pages_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_memory_trim_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_profiling_get_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_jit_profiling_set_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -1269,6 +1970,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_convert_result_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.x86.dll", EntryPoint = "pcrenet_valid_utf_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -1292,6 +1999,18 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_serialize_code_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_serialize_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -1358,6 +2077,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_get_callouts_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_get_prefilter_info_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -1370,6 +2095,48 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_stack_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_memory_get_stats_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_memory_set_huge_pages_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_memory_trim_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_profiling_get_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_jit_profiling_set_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -1382,6 +2149,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_convert_result_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.x64.dll", EntryPoint = "pcrenet_valid_utf_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -1405,6 +2178,18 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_serialize_code_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_serialize_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -1471,6 +2256,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_get_callouts_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_get_prefilter_info_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -1483,6 +2274,48 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_stack_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_memory_get_stats_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_memory_set_huge_pages_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_memory_trim_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_profiling_get_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_jit_profiling_set_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -1495,6 +2328,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_convert_result_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.so", EntryPoint = "pcrenet_valid_utf_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
     [SuppressUnmanagedCodeSecurity]
@@ -1518,6 +2357,18 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_code_free(void* code);
 
+        public override int serialize_code(void* code, byte** bytes, uint* size)
+            => pcrenet_serialize_code(code, bytes, size);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_serialize_code_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_serialize_code(void* code, byte** bytes, uint* size);
+
+        public override void serialize_code_free(byte* bytes)
+            => pcrenet_serialize_code_free(bytes);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_serialize_code_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_serialize_code_free(byte* bytes);
+
         public override int pattern_info(void* code, uint key, void* data)
             => pcrenet_pattern_info(code, key, data);
 
@@ -1584,6 +2435,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_get_callouts_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_get_callouts(void* code, Native.pcre2_callout_enumerate_block* data);
 
+        public override void get_prefilter_info(void* code, Native.prefilter_info* info)
+            => pcrenet_get_prefilter_info(code, info);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_get_prefilter_info_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_get_prefilter_info(void* code, Native.prefilter_info* info);
+
         public override void* jit_stack_create(uint startSize, uint maxSize)
             => pcrenet_jit_stack_create(startSize, maxSize);
 
@@ -1596,6 +2453,48 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_stack_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_jit_stack_free(void* stack);
 
+        public override void jit_memory_get_stats(Native.jit_memory_stats* stats)
+            => pcrenet_jit_memory_get_stats(stats);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_memory_get_stats_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_get_stats(Native.jit_memory_stats* stats);
+
+        public override void jit_memory_set_huge_pages(int enabled)
+            => pcrenet_jit_memory_set_huge_pages(enabled);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_memory_set_huge_pages_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_set_huge_pages(int enabled);
+
+        public override int jit_memory_enable_custom_allocator()
+            => pcrenet_jit_memory_enable_custom_allocator();
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_memory_enable_custom_allocator_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_jit_memory_enable_custom_allocator();
+
+        public override void jit_memory_trim()
+            => pcrenet_jit_memory_trim();
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_memory_trim_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_memory_trim();
+
+        public override uint jit_profiling_get_supported_flags()
+            => pcrenet_jit_profiling_get_supported_flags();
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_profiling_get_supported_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_supported_flags();
+
+        public override uint jit_profiling_get_flags()
+            => pcrenet_jit_profiling_get_flags();
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_profiling_get_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern uint pcrenet_jit_profiling_get_flags();
+
+        public override void jit_profiling_set_flags(uint flags)
+            => pcrenet_jit_profiling_set_flags(flags);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_jit_profiling_set_flags_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern void pcrenet_jit_profiling_set_flags(uint flags);
+
         public override int convert(Native.convert_input* input, Native.convert_result* result)
             => pcrenet_convert(input, result);
 
@@ -1608,6 +2507,12 @@ internal readonly unsafe partial struct Native16Bit : INative
         [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_convert_result_free_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
         private static extern void pcrenet_convert_result_free(void* str);
 
+        public override int valid_utf(void* subject, uint length, uint* errorOffset)
+            => pcrenet_valid_utf(subject, length, errorOffset);
+
+        [DllImport("PCRE.NET.Native.dylib", EntryPoint = "pcrenet_valid_utf_16", ExactSpelling = true, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int pcrenet_valid_utf(void* subject, uint length, uint* errorOffset);
+
     }
 
 #endif
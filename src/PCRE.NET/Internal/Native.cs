@@ -58,6 +58,8 @@ internal static unsafe class Native
         public uint max_pattern_compiled_length;
         public uint optimization_directives_count;
         public uint* optimization_directives;
+        public byte* serialized_code;
+        public uint serialized_code_size;
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -70,6 +72,9 @@ internal static unsafe class Native
         public uint name_count;
         public uint name_entry_size;
         public void* name_entry_table;
+        public uint deserialized;
+        public int jit_error_code;
+        public ulong jit_duration;
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -80,6 +85,12 @@ internal static unsafe class Native
         public uint heap_limit;
         public uint offset_limit;
         public void* jit_stack;
+        public ulong timeout;
+        public int* cancellation_flag;
+        public uint auto_callouts;
+        public uint* callout_filter;
+        public uint collect_stats;
+        public uint collect_profile;
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -94,6 +105,9 @@ internal static unsafe class Native
         public nuint* output_vector;
         public void* callout;
         public void* callout_data;
+        public uint ranges_only;
+        public uint output_group_count;
+        public uint* output_groups;
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -106,6 +120,7 @@ internal static unsafe class Native
         public uint additional_options;
         public void* callout;
         public void* callout_data;
+        public int* cancellation_flag;
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -121,6 +136,7 @@ internal static unsafe class Native
         public void* callout_data;
         public uint max_results;
         public uint workspace_size;
+        public match_settings settings;
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -165,9 +181,53 @@ internal static unsafe class Native
         // Input
         public void* code;
         public match_settings settings;
+        public uint profile_length;
 
         // Output
         public nuint* output_vector;
+        public match_stats* stats;
+        public profile_entry* profile;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal ref struct match_stats
+    {
+        public ulong step_count;
+        public ulong backtrack_count;
+        public ulong start_position_count;
+        public ulong skipped_length;
+        public ulong heap_frames_size;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct profile_entry
+    {
+        public ulong hit_count;
+        public ulong sample_count;
+        public ulong sampled_time;
+        public uint next_item_length;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal ref struct prefilter_info
+    {
+        public uint flags;
+        public uint min_length;
+        public uint first_code_unit;
+        public uint first_code_unit2;
+        public uint last_code_unit;
+        public uint last_code_unit2;
+        public fixed byte start_bitmap[32];
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal ref struct jit_memory_stats
+    {
+        public ulong reserved_size;
+        public ulong allocated_size;
+        public ulong allocation_count;
+        public ulong region_count;
+        public uint flags;
     }
 
     [StructLayout(LayoutKind.Sequential)]
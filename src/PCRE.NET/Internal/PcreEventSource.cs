@@ -0,0 +1,142 @@
+﻿using System.Diagnostics.Tracing;
+using System.Threading;
+#if NETCOREAPP3_0_OR_GREATER
+using System;
+#endif
+
+namespace PCRE.Internal;
+
+/// <summary>
+/// Publishes the PCRE.NET event counters, which can be watched with <c>dotnet-counters</c>.
+/// </summary>
+[EventSource(Name = Metrics.Name)]
+internal sealed class PcreEventSource : EventSource
+{
+    public static readonly PcreEventSource Log = new();
+
+    private long _compileCount;
+    private long _jitCompileFailures;
+    private long _cacheHits;
+    private long _cacheMisses;
+    private long _cacheEvictions;
+    private long _interpreterMatches;
+    private long _jitMatches;
+    private long _dfaMatches;
+    private long _literalMatches;
+    private long _matchLimitErrors;
+    private long _jitStackLimitErrors;
+    private long _substituteRetries;
+
+#if NETCOREAPP3_0_OR_GREATER
+    private EventCounter? _compileDurationCounter;
+    private EventCounter? _jitCompileDurationCounter;
+    private IncrementingPollingCounter[]? _counters;
+#endif
+
+    private PcreEventSource()
+    {
+    }
+
+    [NonEvent]
+    public void RecordCompile(double durationSeconds, double? jitDurationSeconds, bool jitFailed)
+    {
+        Interlocked.Increment(ref _compileCount);
+
+        if (jitFailed)
+            Interlocked.Increment(ref _jitCompileFailures);
+
+#if NETCOREAPP3_0_OR_GREATER
+        _compileDurationCounter?.WriteMetric(durationSeconds * 1000);
+
+        if (jitDurationSeconds is { } jitDuration)
+            _jitCompileDurationCounter?.WriteMetric(jitDuration * 1000);
+#endif
+    }
+
+    [NonEvent]
+    public void RecordCacheLookup(bool hit)
+        => Interlocked.Increment(ref hit ? ref _cacheHits : ref _cacheMisses);
+
+    [NonEvent]
+    public void RecordCacheEviction()
+        => Interlocked.Increment(ref _cacheEvictions);
+
+    [NonEvent]
+    public void RecordMatch(Metrics.MatchEngine engine)
+    {
+        switch (engine)
+        {
+            case Metrics.MatchEngine.Jit:
+                Interlocked.Increment(ref _jitMatches);
+                break;
+
+            case Metrics.MatchEngine.Dfa:
+                Interlocked.Increment(ref _dfaMatches);
+                break;
+
+            case Metrics.MatchEngine.Literal:
+                Interlocked.Increment(ref _literalMatches);
+                break;
+
+            default:
+                Interlocked.Increment(ref _interpreterMatches);
+                break;
+        }
+    }
+
+    [NonEvent]
+    public void RecordMatchError(bool jitStackLimit)
+        => Interlocked.Increment(ref jitStackLimit ? ref _jitStackLimitErrors : ref _matchLimitErrors);
+
+    [NonEvent]
+    public void RecordSubstituteRetries(uint count)
+        => Interlocked.Add(ref _substituteRetries, count);
+
+#if NETCOREAPP3_0_OR_GREATER
+    protected override void OnEventCommand(EventCommandEventArgs command)
+    {
+        if (command.Command != EventCommand.Enable || _counters is not null)
+            return;
+
+        _compileDurationCounter = new EventCounter("compile-duration", this) { DisplayName = "Pattern Compilation Duration", DisplayUnits = "ms" };
+        _jitCompileDurationCounter = new EventCounter("jit-compile-duration", this) { DisplayName = "JIT Compilation Duration", DisplayUnits = "ms" };
+
+        _counters = new[]
+        {
+            CreateCounter("compile-count", "Pattern Compilations", () => Volatile.Read(ref _compileCount)),
+            CreateCounter("jit-compile-failures", "JIT Compilation Failures", () => Volatile.Read(ref _jitCompileFailures)),
+            CreateCounter("regex-cache-hits", "Regex Cache Hits", () => Volatile.Read(ref _cacheHits)),
+            CreateCounter("regex-cache-misses", "Regex Cache Misses", () => Volatile.Read(ref _cacheMisses)),
+            CreateCounter("regex-cache-evictions", "Regex Cache Evictions", () => Volatile.Read(ref _cacheEvictions)),
+            CreateCounter("interpreter-match-count", "Interpreter Matches", () => Volatile.Read(ref _interpreterMatches)),
+            CreateCounter("jit-match-count", "JIT Matches", () => Volatile.Read(ref _jitMatches)),
+            CreateCounter("dfa-match-count", "DFA Matches", () => Volatile.Read(ref _dfaMatches)),
+            CreateCounter("literal-match-count", "Literal Matches", () => Volatile.Read(ref _literalMatches)),
+            CreateCounter("match-limit-errors", "Match Limit Errors", () => Volatile.Read(ref _matchLimitErrors)),
+            CreateCounter("jit-stack-limit-errors", "JIT Stack Limit Errors", () => Volatile.Read(ref _jitStackLimitErrors)),
+            CreateCounter("substitute-retries", "Substitution Retry Passes", () => Volatile.Read(ref _substituteRetries))
+        };
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        if (disposing)
+        {
+            _compileDurationCounter?.Dispose();
+            _jitCompileDurationCounter?.Dispose();
+
+            foreach (var counter in _counters ?? [])
+                counter.Dispose();
+        }
+
+        base.Dispose(disposing);
+    }
+
+    private IncrementingPollingCounter CreateCounter(string name, string displayName, Func<double> getValue)
+        => new(name, this, getValue)
+        {
+            DisplayName = displayName,
+            DisplayRateTimeScale = TimeSpan.FromSeconds(1)
+        };
+#endif
+}
@@ -0,0 +1,287 @@
+﻿using System;
+using System.Collections.Concurrent;
+using System.IO;
+using System.Reflection;
+using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading;
+
+namespace PCRE.Internal;
+
+/// <summary>
+/// Stores compiled patterns on disk, so they can be reloaded instead of compiled again by another process.
+/// </summary>
+/// <remarks>
+/// Entries are keyed by the pattern, its compile settings, the character width, the PCRE2 version and the process architecture.
+/// The full key is stored in each file and compared on load, and a checksum protects the file contents.
+/// Any mismatch or I/O error causes the pattern to be compiled normally, and the entry to be written again.
+/// Entries can also be embedded in assemblies as resources, which are looked up before the cache directory.
+/// </remarks>
+internal static unsafe class PersistentCache
+{
+    private const string _fileExtension = ".pcre";
+    private const string _resourcePrefix = "PCRE.NET.Precompiled.";
+    private const ulong _fnvOffsetBasis = 0xcbf29ce484222325;
+    private const ulong _fnvPrime = 0x100000001b3;
+
+    private static readonly byte[] _magic = "PCRENET1"u8.ToArray();
+    private static readonly byte[] _environmentKey = Encoding.UTF8.GetBytes($"{PcreBuildInfo.Version}|{RuntimeInformation.ProcessArchitecture}|{IntPtr.Size}|{BitConverter.IsLittleEndian}");
+
+    private static readonly ConcurrentDictionary<string, Func<Stream?>> _precompiledEntries = new(StringComparer.Ordinal);
+
+    private static string? _directory;
+    private static long _hitCount;
+    private static long _missCount;
+
+    public static string? Directory
+    {
+        get => Volatile.Read(ref _directory);
+        set => Volatile.Write(ref _directory, value is null ? null : Path.GetFullPath(value));
+    }
+
+    public static long HitCount => Interlocked.Read(ref _hitCount);
+    public static long MissCount => Interlocked.Read(ref _missCount);
+
+    public static bool HasPrecompiledEntries => !_precompiledEntries.IsEmpty;
+
+    public static void AddPrecompiledEntries(Assembly assembly)
+    {
+        foreach (var resourceName in assembly.GetManifestResourceNames())
+        {
+            if (resourceName.StartsWith(_resourcePrefix, StringComparison.Ordinal) && resourceName.EndsWith(_fileExtension, StringComparison.Ordinal))
+                AddPrecompiledEntry(resourceName.Substring(_resourcePrefix.Length), () => assembly.GetManifestResourceStream(resourceName));
+        }
+    }
+
+    public static void AddPrecompiledEntry(string fileName, Func<Stream?> openStream)
+        => _precompiledEntries.TryAdd(fileName, openStream);
+
+    public static void ClearPrecompiledEntries()
+        => _precompiledEntries.Clear();
+
+    public static byte[] GetKey(ref Native.compile_input input, ReadOnlySpan<byte> pattern, int charSize)
+    {
+        using var stream = new MemoryStream();
+        using var writer = new BinaryWriter(stream);
+
+        writer.Write(_environmentKey);
+        writer.Write(charSize);
+        writer.Write(input.flags);
+        writer.Write(input.flags_jit);
+        writer.Write(input.new_line);
+        writer.Write(input.bsr);
+        writer.Write(input.parens_nest_limit);
+        writer.Write(input.max_pattern_length);
+        writer.Write(input.compile_extra_options);
+        writer.Write(input.max_var_lookbehind);
+        writer.Write(input.max_pattern_compiled_length);
+        writer.Write(input.optimization_directives_count);
+
+        for (var i = 0; i < input.optimization_directives_count; ++i)
+            writer.Write(input.optimization_directives[i]);
+
+        writer.Write(pattern.Length);
+        writer.Flush();
+
+#if NET
+        stream.Write(pattern);
+#else
+        stream.Write(pattern.ToArray(), 0, pattern.Length);
+#endif
+
+        return stream.ToArray();
+    }
+
+    public static ArraySegment<byte> Load(string? directory, byte[] key)
+    {
+        var fileName = GetFileName(key);
+
+        if (_precompiledEntries.TryGetValue(fileName, out var openStream))
+        {
+            var precompiledCode = ReadEntry(ReadPrecompiledEntry(openStream), key);
+            if (precompiledCode.Count != 0)
+                return precompiledCode;
+        }
+
+        return directory is not null
+            ? ReadEntry(ReadFile(Path.Combine(directory, fileName)), key)
+            : default;
+    }
+
+    private static byte[]? ReadFile(string path)
+    {
+        try
+        {
+            return File.Exists(path) ? File.ReadAllBytes(path) : null;
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            return null;
+        }
+    }
+
+    private static byte[]? ReadPrecompiledEntry(Func<Stream?> openStream)
+    {
+        try
+        {
+            using var stream = openStream();
+            if (stream is null)
+                return null;
+
+            using var buffer = new MemoryStream();
+            stream.CopyTo(buffer);
+            return buffer.ToArray();
+        }
+        catch (IOException)
+        {
+            return null;
+        }
+    }
+
+    private static ArraySegment<byte> ReadEntry(byte[]? data, byte[] key)
+    {
+        if (data is null)
+            return default;
+
+        // Layout: magic, key length, key, code length, code, checksum
+
+        var span = data.AsSpan();
+        var offset = _magic.Length;
+
+        if (span.Length < offset + 2 * sizeof(int) + sizeof(ulong) || !span.Slice(0, offset).SequenceEqual(_magic))
+            return default;
+
+        if (ComputeChecksum(span.Slice(0, span.Length - sizeof(ulong))) != MemoryMarshal.Read<ulong>(span.Slice(span.Length - sizeof(ulong))))
+            return default;
+
+        var keyLength = MemoryMarshal.Read<int>(span.Slice(offset));
+        offset += sizeof(int);
+
+        if (keyLength != key.Length || span.Length - offset < keyLength + sizeof(int) + sizeof(ulong) || !span.Slice(offset, keyLength).SequenceEqual(key))
+            return default;
+
+        offset += keyLength;
+
+        var codeLength = MemoryMarshal.Read<int>(span.Slice(offset));
+        offset += sizeof(int);
+
+        if (codeLength <= 0 || codeLength != span.Length - offset - sizeof(ulong))
+            return default;
+
+        return new ArraySegment<byte>(data, offset, codeLength);
+    }
+
+    public static void Store<TNative>(string directory, byte[] key, void* code)
+        where TNative : struct, INative
+    {
+        Interlocked.Increment(ref _missCount);
+
+        byte* serializedCode;
+        uint serializedCodeSize;
+
+        if (default(TNative).serialize_code(code, &serializedCode, &serializedCodeSize) != 0)
+            return;
+
+        using var stream = new MemoryStream();
+
+        try
+        {
+            using var writer = new BinaryWriter(stream, Encoding.UTF8, true);
+
+            writer.Write(_magic);
+            writer.Write(key.Length);
+            writer.Write(key);
+            writer.Write((int)serializedCodeSize);
+            writer.Flush();
+
+#if NET
+            stream.Write(new ReadOnlySpan<byte>(serializedCode, (int)serializedCodeSize));
+#else
+            stream.Write(new ReadOnlySpan<byte>(serializedCode, (int)serializedCodeSize).ToArray(), 0, (int)serializedCodeSize);
+#endif
+
+            writer.Write(ComputeChecksum(stream.GetBuffer().AsSpan(0, (int)stream.Length)));
+        }
+        finally
+        {
+            default(TNative).serialize_code_free(serializedCode);
+        }
+
+        WriteFile(Path.Combine(directory, GetFileName(key)), stream.ToArray());
+    }
+
+    public static void Clear()
+    {
+        var directory = Directory;
+        if (directory is null || !System.IO.Directory.Exists(directory))
+            return;
+
+        foreach (var path in System.IO.Directory.GetFiles(directory, "*" + _fileExtension))
+        {
+            try
+            {
+                File.Delete(path);
+            }
+            catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+            {
+                // The file is in use, it will be overwritten if it's invalid
+            }
+        }
+    }
+
+    public static void RecordHit()
+        => Interlocked.Increment(ref _hitCount);
+
+    private static void WriteFile(string path, byte[] data)
+    {
+        // Write to a temporary file first, so other processes never see a partially written entry
+
+        var tempPath = path + "." + Guid.NewGuid().ToString("N") + ".tmp";
+
+        try
+        {
+            System.IO.Directory.CreateDirectory(Path.GetDirectoryName(path)!);
+            File.WriteAllBytes(tempPath, data);
+
+            // Replace the entry in a single step, so readers see either the previous entry or the new one
+#if NETCOREAPP3_0_OR_GREATER
+            File.Move(tempPath, path, overwrite: true);
+#else
+            if (File.Exists(path))
+                File.Replace(tempPath, path, null);
+            else
+                File.Move(tempPath, path);
+#endif
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            // Another process may have written the same entry concurrently
+
+            try
+            {
+                File.Delete(tempPath);
+            }
+            catch (Exception deleteEx) when (deleteEx is IOException or UnauthorizedAccessException)
+            {
+            }
+        }
+    }
+
+    private static string GetFileName(byte[] key)
+        => ComputeChecksum(key).ToString("x16") + _fileExtension;
+
+    private static ulong ComputeChecksum(ReadOnlySpan<byte> data)
+    {
+        // FNV-1a
+
+        var hash = _fnvOffsetBasis;
+
+        foreach (var b in data)
+        {
+            hash ^= b;
+            hash *= _fnvPrime;
+        }
+
+        return hash;
+    }
+}
@@ -11,6 +11,7 @@ internal class PriorityCache<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TVal
 {
     private readonly Func<TKey, TValue> _valueFactory;
     private readonly IEqualityComparer<TKey> _keyComparer;
+    private readonly bool _recordMetrics;
     private readonly LinkedList<CacheItem> _cache = new();
 
 #if NET9_0_OR_GREATER
@@ -22,10 +23,11 @@ internal class PriorityCache<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TVal
     private int _cacheSize;
     private object? _head;
 
-    public PriorityCache(int cacheSize, Func<TKey, TValue> valueFactory, IEqualityComparer<TKey>? keyComparer = null)
+    public PriorityCache(int cacheSize, Func<TKey, TValue> valueFactory, IEqualityComparer<TKey>? keyComparer = null, bool recordMetrics = false)
     {
         _valueFactory = valueFactory;
         _keyComparer = keyComparer ?? EqualityComparer<TKey>.Default;
+        _recordMetrics = recordMetrics;
         CacheSize = cacheSize;
     }
 
@@ -40,7 +42,10 @@ internal class PriorityCache<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TVal
             lock (_lock)
             {
                 while (_cache.Count > value)
+                {
                     _cache.RemoveLast();
+                    RecordEviction();
+                }
 
                 if (value == 0)
                     _head = null;
@@ -67,10 +72,16 @@ internal class PriorityCache<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TVal
 
         var head = (CacheItem?)Volatile.Read(ref _head);
         if (head != null && head.KeyHashCode == keyHash && _keyComparer.Equals(head.Key, key))
+        {
+            RecordLookup(true);
             return head.Value;
+        }
 
         if (_cacheSize == 0)
+        {
+            RecordLookup(false);
             return _valueFactory(key);
+        }
 
         lock (_lock)
         {
@@ -81,11 +92,14 @@ internal class PriorityCache<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TVal
                     Volatile.Write(ref _head, node.Value);
                     _cache.Remove(node);
                     _cache.AddFirst(node);
+                    RecordLookup(true);
                     return node.Value.Value;
                 }
             }
         }
 
+        RecordLookup(false);
+
         var item = new CacheItem(key, keyHash, _valueFactory(key));
         Volatile.Write(ref _head, item);
 
@@ -93,11 +107,27 @@ internal class PriorityCache<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TVal
         {
             _cache.AddFirst(item);
             if (_cache.Count > _cacheSize)
+            {
                 _cache.RemoveLast();
+                RecordEviction();
+            }
+
             return item.Value;
         }
     }
 
+    private void RecordLookup(bool hit)
+    {
+        if (_recordMetrics)
+            Metrics.RecordCacheLookup(hit);
+    }
+
+    private void RecordEviction()
+    {
+        if (_recordMetrics)
+            Metrics.RecordCacheEviction();
+    }
+
     private class CacheItem(TKey key, int keyHashCode, TValue value)
     {
         public readonly TKey Key = key;
@@ -10,14 +10,25 @@ public sealed unsafe class PcreCallout
 {
     private readonly string _subject;
     private readonly InternalRegex _regex;
-    private readonly uint _flags;
-    private readonly nuint[] _oVector;
-    private readonly char* _markPtr;
+    private uint _flags;
+    private nuint[] _oVector = [];
+    private char* _markPtr;
+    private PcreMatch? _match;
+    private PcreCalloutInfo? _info;
 
     internal PcreCallout(string subject, InternalRegex regex, Native.pcre2_callout_block* callout)
     {
         _subject = subject;
         _regex = regex;
+
+        Update(callout);
+    }
+
+    /// <summary>
+    /// Reinitializes this instance for another callout of the same match.
+    /// </summary>
+    internal void Update(Native.pcre2_callout_block* callout)
+    {
         _flags = callout->callout_flags;
 
         Number = (int)callout->callout_number;
@@ -25,11 +36,19 @@ public sealed unsafe class PcreCallout
         CurrentOffset = (int)callout->current_position;
         MaxCapture = (int)callout->capture_top;
         LastCapture = (int)callout->capture_last;
-        PatternPosition = (int)callout->pattern_position;
         NextPatternItemLength = (int)callout->next_item_length;
         _markPtr = (char*)callout->mark;
+        _match = null;
+
+        if (PatternPosition != (int)callout->pattern_position)
+        {
+            PatternPosition = (int)callout->pattern_position;
+            _info = null;
+        }
+
+        if (_oVector.Length != callout->capture_top * 2)
+            _oVector = new nuint[callout->capture_top * 2];
 
-        _oVector = new nuint[callout->capture_top * 2];
         _oVector[0] = callout->start_match;
         _oVector[1] = callout->current_position;
 
@@ -38,12 +57,12 @@ public sealed unsafe class PcreCallout
     }
 
     /// <inheritdoc cref="PcreCalloutInfo.Number"/>
-    public int Number { get; }
+    public int Number { get; private set; }
 
     /// <summary>
     /// Returns the current match status.
     /// </summary>
-    public PcreMatch Match => field ??= new PcreMatch(_subject, _regex, _oVector, _markPtr);
+    public PcreMatch Match => _match ??= new PcreMatch(_subject, _regex, _oVector, _markPtr);
 
     /// <summary>
     /// The offset within the subject at which the current match attempt started.
@@ -52,12 +71,12 @@ public sealed unsafe class PcreCallout
     /// If the escape sequence <c>\K</c> has been encountered, this value is changed to reflect the modified starting point.
     /// If the pattern is not anchored, the callout function may be called several times from the same point in the pattern for different starting points in the subject.
     /// </remarks>
-    public int StartOffset { get; }
+    public int StartOffset { get; private set; }
 
     /// <summary>
     /// The offset within the subject of the current match pointer.
     /// </summary>
-    public int CurrentOffset { get; }
+    public int CurrentOffset { get; private set; }
 
     /// <summary>
     /// One more than the number of the highest numbered captured substring so far.
@@ -65,7 +84,7 @@ public sealed unsafe class PcreCallout
     /// <remarks>
     /// If no substrings have yet been captured, the value is 1.
     /// </remarks>
-    public int MaxCapture { get; }
+    public int MaxCapture { get; private set; }
 
     /// <summary>
     /// The number of the most recently captured substring.
@@ -73,13 +92,13 @@ public sealed unsafe class PcreCallout
     /// <remarks>
     /// If no substrings have yet been captured, the value is 0.
     /// </remarks>
-    public int LastCapture { get; }
+    public int LastCapture { get; private set; }
 
     /// <inheritdoc cref="PcreCalloutInfo.PatternPosition"/>
-    public int PatternPosition { get; }
+    public int PatternPosition { get; private set; }
 
     /// <inheritdoc cref="PcreCalloutInfo.NextPatternItemLength"/>
-    public int NextPatternItemLength { get; }
+    public int NextPatternItemLength { get; private set; }
 
     /// <inheritdoc cref="PcreCalloutInfo.StringOffset"/>
     public int StringOffset => Info.StringOffset;
@@ -91,7 +110,7 @@ public sealed unsafe class PcreCallout
     /// <summary>
     /// Returns information about the callout.
     /// </summary>
-    public PcreCalloutInfo Info => field ??= _regex.GetCalloutInfoByPatternPosition(PatternPosition);
+    public PcreCalloutInfo Info => _info ??= _regex.GetCalloutInfoByPatternPosition(PatternPosition);
 
     /// <summary>
     /// <c>PCRE2_CALLOUT_STARTMATCH</c> - This is set for the first callout after the start of matching for each new starting position in the subject.
@@ -0,0 +1,103 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using PCRE.Internal;
+
+namespace PCRE;
+
+/// <summary>
+/// Selects the callouts which are passed to callout functions.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Callouts are filtered in native code: the callouts which are not selected continue the match as if the callout function returned <see cref="PcreCalloutResult.Pass"/>,
+/// without calling into managed code. This is useful for patterns which contain many callouts of which only a few are relevant for a given call.
+/// </para>
+/// <para>
+/// Numeric callouts are selected by number, and string callouts by their string. The <see cref="None"/> filter selects no callout at all, in which case the callout
+/// function is not even registered with PCRE2.
+/// </para>
+/// </remarks>
+/// <seealso cref="PcreMatchSettings.CalloutFilter"/>
+public sealed class PcreCalloutFilter
+{
+    private const int _numbersSize = 8;
+    private const int _headerSize = _numbersSize + 1;
+
+    private readonly uint[] _numbersOnlyData = new uint[_headerSize];
+    private readonly HashSet<string> _strings;
+    private readonly ConditionalWeakTable<InternalRegex, uint[]> _dataByRegex = new();
+    private readonly ConditionalWeakTable<InternalRegex, uint[]>.CreateValueCallback _createData;
+
+    /// <summary>
+    /// A filter which selects no callout.
+    /// </summary>
+    public static PcreCalloutFilter None { get; } = new([], []);
+
+    /// <summary>
+    /// Creates a callout filter.
+    /// </summary>
+    /// <param name="numbers">The numbers of the numeric callouts to select, between 0 and 255.</param>
+    /// <param name="strings">The strings of the string callouts to select.</param>
+    public PcreCalloutFilter(IEnumerable<int> numbers, IEnumerable<string> strings)
+    {
+        if (numbers is null)
+            throw new ArgumentNullException(nameof(numbers));
+
+        if (strings is null)
+            throw new ArgumentNullException(nameof(strings));
+
+        foreach (var number in numbers)
+        {
+            if (number is < 0 or > 255)
+                throw new ArgumentOutOfRangeException(nameof(numbers), "Callout numbers must be between 0 and 255.");
+
+            _numbersOnlyData[number >> 5] |= 1u << (number & 31);
+        }
+
+        _strings = new HashSet<string>(strings, StringComparer.Ordinal);
+        _createData = CreateData;
+    }
+
+    /// <summary>
+    /// Creates a callout filter which selects numeric callouts.
+    /// </summary>
+    /// <param name="numbers">The numbers of the callouts to select, between 0 and 255.</param>
+    public static PcreCalloutFilter FromNumbers(params int[] numbers)
+        => new(numbers, []);
+
+    /// <summary>
+    /// Creates a callout filter which selects string callouts.
+    /// </summary>
+    /// <param name="strings">The strings of the callouts to select.</param>
+    public static PcreCalloutFilter FromStrings(params string[] strings)
+        => new([], strings);
+
+    /// <summary>
+    /// Returns the native representation of the filter for a given pattern, as string callouts are identified by their offset in the pattern.
+    /// </summary>
+    internal uint[] GetData(InternalRegex regex)
+        => _strings.Count == 0
+            ? _numbersOnlyData
+            : _dataByRegex.GetValue(regex, _createData);
+
+    private uint[] CreateData(InternalRegex regex)
+    {
+        var offsets = new List<uint>();
+
+        foreach (var callout in regex.GetCallouts())
+        {
+            if (callout.String is not null && _strings.Contains(callout.String))
+                offsets.Add((uint)callout.StringOffset);
+        }
+
+        offsets.Sort();
+
+        var data = new uint[_headerSize + offsets.Count];
+        Array.Copy(_numbersOnlyData, data, _numbersSize);
+        data[_numbersSize] = (uint)offsets.Count;
+        offsets.CopyTo(data, _headerSize);
+
+        return data;
+    }
+}
@@ -997,4 +997,20 @@ public enum PcreErrorCode
     /// <c>PCRE2_ERROR_BAD_BACKSLASH_K</c> - Disallowed use of <c>\K</c> in lookaround.
     /// </summary>
     BadBackslashK = PcreConstants.PCRE2_ERROR_BAD_BACKSLASH_K,
+
+    /// <summary>
+    /// The match timeout has elapsed, see <see cref="PcreMatchSettings.Timeout"/>.
+    /// </summary>
+    /// <remarks>
+    /// This error code is specific to PCRE.NET.
+    /// </remarks>
+    MatchTimeout = -1001,
+
+    /// <summary>
+    /// The match has been cancelled, see <see cref="PcreMatchSettings.CancellationToken"/>.
+    /// </summary>
+    /// <remarks>
+    /// This error code is specific to PCRE.NET. An <see cref="System.OperationCanceledException"/> is thrown when a match is cancelled.
+    /// </remarks>
+    MatchCancelled = -1002,
 }
@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Threading;
 using PCRE.Internal;
 
 namespace PCRE;
@@ -231,6 +232,52 @@ public class PcreCalloutException : PcreMatchException
     { }
 }
 
+/// <summary>
+/// Represents a match which took longer than its timeout.
+/// </summary>
+/// <seealso cref="PcreMatchSettings.Timeout"/>
+public class PcreMatchTimeoutException : PcreMatchException
+{
+    /// <summary>
+    /// The timeout of the match which was abandoned.
+    /// </summary>
+    public TimeSpan MatchTimeout { get; } = Timeout.InfiniteTimeSpan;
+
+    /// <summary>
+    /// Creates a new <see cref="PcreMatchTimeoutException"/>.
+    /// </summary>
+    public PcreMatchTimeoutException()
+        : base(PcreErrorCode.MatchTimeout)
+    { }
+
+    /// <summary>
+    /// Creates a new <see cref="PcreMatchTimeoutException"/>.
+    /// </summary>
+    /// <param name="message">The exception message.</param>
+    public PcreMatchTimeoutException(string message)
+        : base(PcreErrorCode.MatchTimeout, message)
+    { }
+
+    /// <summary>
+    /// Creates a new <see cref="PcreMatchTimeoutException"/>.
+    /// </summary>
+    /// <param name="message">The exception message.</param>
+    /// <param name="innerException">The inner exception.</param>
+    public PcreMatchTimeoutException(string message, Exception? innerException)
+        : base(PcreErrorCode.MatchTimeout, message, innerException)
+    { }
+
+    /// <summary>
+    /// Creates a new <see cref="PcreMatchTimeoutException"/>.
+    /// </summary>
+    /// <param name="matchTimeout">The timeout of the match.</param>
+    public PcreMatchTimeoutException(TimeSpan matchTimeout)
+        : base(PcreErrorCode.MatchTimeout, $"The match timed out after {matchTimeout}.")
+    {
+        MatchTimeout = matchTimeout;
+    }
+}
+
 /// <summary>
 /// Represents an error that occured during pattern substitution.
 /// </summary>
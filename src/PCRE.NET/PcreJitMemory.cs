@@ -0,0 +1,98 @@
+﻿using PCRE.Internal;
+
+namespace PCRE;
+
+/// <summary>
+/// Provides information about the executable memory used by JIT-compiled patterns.
+/// </summary>
+/// <remarks>
+/// <para>
+/// By default, the PCRE2 executable memory allocator is used for JIT code, which has a separate instance for each character width.
+/// </para>
+/// <para>
+/// On Linux, PCRE.NET provides its own allocator, which can be enabled with <see cref="TryEnableCustomAllocator"/>. It reserves memory in 2 MiB regions
+/// which are distributed between several arenas, so patterns can be compiled concurrently from different threads without contending on a single lock.
+/// </para>
+/// <para>
+/// Memory released by JIT-compiled patterns may be kept for future use. Call <see cref="Trim"/> to give it back to the operating system,
+/// for instance after a large set of patterns has been unloaded, or when the process is under memory pressure.
+/// </para>
+/// </remarks>
+public static unsafe class PcreJitMemory
+{
+    private const uint CustomAllocatorFlag = 0x01;
+    private const uint HugePagesFlag = 0x02;
+
+    /// <summary>
+    /// Indicates if the PCRE.NET executable memory allocator is used for JIT code.
+    /// </summary>
+    public static bool IsCustomAllocator => (GetNativeStatistics().flags & CustomAllocatorFlag) != 0;
+
+    /// <summary>
+    /// Enables the PCRE.NET executable memory allocator for JIT code.
+    /// </summary>
+    /// <returns>
+    /// <c>true</c> if the PCRE.NET allocator is used, <c>false</c> if it is not available on this platform,
+    /// or if JIT code has already been allocated by the PCRE2 allocator.
+    /// </returns>
+    /// <remarks>
+    /// The allocator cannot change once JIT code has been allocated, so this needs to be called on startup,
+    /// before any pattern is compiled with <see cref="PcreOptions.Compiled"/>.
+    /// </remarks>
+    public static bool TryEnableCustomAllocator()
+        => default(Native16Bit).jit_memory_enable_custom_allocator() != 0;
+
+    /// <summary>
+    /// Gets or sets whether newly reserved regions of executable memory should be backed by transparent huge pages.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Huge pages reduce the number of TLB misses when a large number of JIT-compiled patterns are executed.
+    /// This is only a hint to the operating system, and it only applies to memory reserved after the setting is changed.
+    /// </para>
+    /// <para>
+    /// This setting has no effect when <see cref="IsCustomAllocator"/> is <c>false</c>.
+    /// </para>
+    /// </remarks>
+    public static bool UseHugePages
+    {
+        get => (GetNativeStatistics().flags & HugePagesFlag) != 0;
+        set => default(Native16Bit).jit_memory_set_huge_pages(value ? 1 : 0);
+    }
+
+    /// <summary>
+    /// Returns statistics about the executable memory used by JIT-compiled patterns.
+    /// </summary>
+    /// <remarks>
+    /// The statistics cover the patterns of all character widths.
+    /// Only <see cref="PcreJitMemoryStatistics.ReservedBytes"/> and <see cref="PcreJitMemoryStatistics.AllocatedBytes"/> are available when <see cref="IsCustomAllocator"/> is <c>false</c>.
+    /// </remarks>
+    public static PcreJitMemoryStatistics GetStatistics()
+    {
+        var stats = GetNativeStatistics();
+
+        return new PcreJitMemoryStatistics(
+            (long)stats.reserved_size,
+            (long)stats.allocated_size,
+            (long)stats.allocation_count,
+            (long)stats.region_count
+        );
+    }
+
+    /// <summary>
+    /// Releases the unused executable memory back to the operating system.
+    /// </summary>
+    /// <remarks>
+    /// The memory used by patterns which are still referenced, either directly or through the cache, is not released.
+    /// </remarks>
+    public static void Trim()
+        => default(Native16Bit).jit_memory_trim();
+
+    private static Native.jit_memory_stats GetNativeStatistics()
+    {
+        // The allocator is shared between the 8-bit and 16-bit libraries.
+        Native.jit_memory_stats stats;
+        default(Native16Bit).jit_memory_get_stats(&stats);
+        return stats;
+    }
+}
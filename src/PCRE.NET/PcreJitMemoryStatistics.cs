@@ -0,0 +1,46 @@
+﻿namespace PCRE;
+
+/// <summary>
+/// Statistics about the executable memory used by JIT-compiled patterns.
+/// </summary>
+/// <seealso cref="PcreJitMemory.GetStatistics"/>
+public readonly struct PcreJitMemoryStatistics
+{
+    internal PcreJitMemoryStatistics(long reservedBytes, long allocatedBytes, long allocationCount, long regionCount)
+    {
+        ReservedBytes = reservedBytes;
+        AllocatedBytes = allocatedBytes;
+        AllocationCount = allocationCount;
+        RegionCount = regionCount;
+    }
+
+    /// <summary>
+    /// The amount of executable memory reserved from the operating system, in bytes.
+    /// </summary>
+    public long ReservedBytes { get; }
+
+    /// <summary>
+    /// The amount of executable memory currently used by JIT code, in bytes.
+    /// </summary>
+    public long AllocatedBytes { get; }
+
+    /// <summary>
+    /// The number of blocks of JIT code currently allocated.
+    /// </summary>
+    /// <remarks>
+    /// This is zero when <see cref="PcreJitMemory.IsCustomAllocator"/> is <c>false</c>.
+    /// </remarks>
+    public long AllocationCount { get; }
+
+    /// <summary>
+    /// The number of memory regions currently reserved from the operating system.
+    /// </summary>
+    /// <remarks>
+    /// This is zero when <see cref="PcreJitMemory.IsCustomAllocator"/> is <c>false</c>.
+    /// </remarks>
+    public long RegionCount { get; }
+
+    /// <inheritdoc />
+    public override string ToString()
+        => $"Reserved: {ReservedBytes}, Allocated: {AllocatedBytes}, Allocations: {AllocationCount}, Regions: {RegionCount}";
+}
@@ -0,0 +1,68 @@
+﻿using PCRE.Internal;
+
+namespace PCRE;
+
+/// <summary>
+/// Makes JIT-compiled patterns visible to native profilers and debuggers.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Without this, the time spent in JIT-compiled patterns is attributed to unknown addresses.
+/// When enabled, the JIT code of each pattern is named after a hash and an excerpt of the pattern,
+/// for instance <c>pcre2:1a2b3c4d:foo\d+bar</c>.
+/// </para>
+/// <para>
+/// Only the patterns which are JIT-compiled while a mode is enabled are registered.
+/// These modes are only supported on Linux.
+/// </para>
+/// </remarks>
+public static class PcreJitProfiler
+{
+    private const uint PerfMapFlag = 0x01;
+    private const uint GdbJitInterfaceFlag = 0x02;
+
+    private static readonly object _lock = new();
+
+    /// <summary>
+    /// Indicates if the profiling modes are supported on the current platform.
+    /// </summary>
+    public static bool IsSupported => (default(Native16Bit).jit_profiling_get_supported_flags() & PerfMapFlag) != 0;
+
+    /// <summary>
+    /// Gets or sets whether JIT-compiled patterns should be written to the <c>/tmp/perf-&lt;pid&gt;.map</c> file used by <c>perf</c>.
+    /// </summary>
+    /// <remarks>
+    /// This file is append-only: the entries of patterns which have been freed are not removed.
+    /// The entries are written to the same file as the .NET runtime when <c>DOTNET_PerfMapEnabled</c> is set.
+    /// </remarks>
+    public static bool PerfMapEnabled
+    {
+        get => GetFlag(PerfMapFlag);
+        set => SetFlag(PerfMapFlag, value);
+    }
+
+    /// <summary>
+    /// Gets or sets whether JIT-compiled patterns should be registered with the GDB JIT interface.
+    /// </summary>
+    /// <remarks>
+    /// Registered patterns are unregistered when they are freed, even if this setting has been disabled in the meantime.
+    /// </remarks>
+    public static bool GdbJitInterfaceEnabled
+    {
+        get => GetFlag(GdbJitInterfaceFlag);
+        set => SetFlag(GdbJitInterfaceFlag, value);
+    }
+
+    private static bool GetFlag(uint flag)
+        => (default(Native16Bit).jit_profiling_get_flags() & flag) != 0;
+
+    private static void SetFlag(uint flag, bool value)
+    {
+        // The profiling state is shared between the 8-bit and 16-bit libraries.
+        lock (_lock)
+        {
+            var flags = default(Native16Bit).jit_profiling_get_flags();
+            default(Native16Bit).jit_profiling_set_flags(value ? flags | flag : flags & ~flag);
+        }
+    }
+}
@@ -11,6 +11,13 @@ internal interface IPcreMatchBuffer
     InternalRegex Regex { get; }
     IntPtr NativeBuffer { get; }
     nuint[] CalloutOutputVector { get; }
+    TimeSpan Timeout { get; }
+    CancellationToken CancellationToken { get; }
+    bool CollectStatistics { get; }
+    bool AllowsLiteralMatch { get; }
+    bool AllowsPrefilter { get; }
+    Span<nuint> OutputVector { get; }
+    ref int PoolState { get; }
 }
 
 /// <summary>
@@ -25,17 +32,33 @@ public sealed unsafe class PcreMatchBuffer : IPcreMatchBuffer, IRegexHolder16Bit
     internal readonly InternalRegex16Bit Regex;
     private readonly int _outputVectorSize;
     private PcreJitStack? _jitStack; // GC reference
+    private readonly TimeSpan _timeout;
+    private readonly CancellationToken _cancellationToken;
+    private readonly bool _allowsLiteralMatch;
+    private readonly bool _allowsPrefilter;
 
     internal IntPtr NativeBuffer;
+    internal int PoolState; // One of the MatchBufferPool states
 
     internal readonly nuint* OutputVector;
     internal readonly nuint[] CalloutOutputVector;
+    private readonly Native.match_stats* _stats;
+    private readonly Native.profile_entry* _profile;
+    private readonly int _profileLength;
 
     InternalRegex IPcreMatchBuffer.Regex => Regex;
     IntPtr IPcreMatchBuffer.NativeBuffer => NativeBuffer;
     nuint[] IPcreMatchBuffer.CalloutOutputVector => CalloutOutputVector;
+    TimeSpan IPcreMatchBuffer.Timeout => _timeout;
+    CancellationToken IPcreMatchBuffer.CancellationToken => _cancellationToken;
+    bool IPcreMatchBuffer.CollectStatistics => _stats != null;
+    bool IPcreMatchBuffer.AllowsLiteralMatch => _allowsLiteralMatch;
+    bool IPcreMatchBuffer.AllowsPrefilter => _allowsPrefilter;
+    Span<nuint> IPcreMatchBuffer.OutputVector => GetOutputVectorSpan();
     InternalRegex16Bit IRegexHolder16Bit.Regex => Regex;
 
+    ref int IPcreMatchBuffer.PoolState => ref PoolState;
+
     [ForwardTo8Bit]
     internal PcreMatchBuffer(InternalRegex16Bit regex, PcreMatchSettings settings)
     {
@@ -46,22 +69,129 @@ public sealed unsafe class PcreMatchBuffer : IPcreMatchBuffer, IRegexHolder16Bit
 
         Regex.TryGetCalloutInfoByPatternPosition(0); // Make sure callout info is initialized
 
-        var info = new Native.match_buffer_info
-        {
-            code = regex.Code
-        };
+        var info = new Native.match_buffer_info();
 
         settings.FillMatchSettings(ref info.settings, out _jitStack);
+        info.settings.collect_stats = settings.CollectStatistics ? 1u : 0u;
+        info.settings.collect_profile = settings.CollectProfile ? 1u : 0u;
+        info.profile_length = settings.CollectProfile ? (uint)regex.PatternLength + 1 : 0;
+        info.code = regex.GetMatchCode(ref info.settings);
+
+        _timeout = settings.Timeout;
+        _cancellationToken = settings.CancellationToken;
+        _allowsLiteralMatch = settings.AllowsLiteralMatch;
+        _allowsPrefilter = settings.AllowsPrefilter;
+
+        // The native buffer keeps its own copy of the callout filter.
+        fixed (uint* pCalloutFilter = settings.CalloutFilter?.GetData(regex))
+        {
+            info.settings.callout_filter = pCalloutFilter;
+            NativeBuffer = (IntPtr)default(Native16Bit).create_match_buffer(&info);
+        }
 
-        NativeBuffer = (IntPtr)default(Native16Bit).create_match_buffer(&info);
         if (NativeBuffer == IntPtr.Zero)
             throw new InvalidOperationException("Could not create match buffer");
 
         OutputVector = info.output_vector;
+        _stats = info.stats;
+        _profile = info.profile;
+        _profileLength = _profile != null ? (int)info.profile_length : 0;
 
         GC.KeepAlive(this);
     }
 
+    /// <summary>
+    /// Statistics about the effort spent by the last match of this buffer.
+    /// </summary>
+    /// <remarks>
+    /// Statistics are only collected when the buffer is created with <see cref="PcreMatchSettings.CollectStatistics"/>, this returns <c>null</c> otherwise.
+    /// The matches of such a buffer always use the interpreter, so the statistics don't describe the JIT.
+    /// </remarks>
+    [ForwardTo8Bit]
+    public PcreMatchStatistics? Statistics
+    {
+        get
+        {
+            if (_stats == null)
+                return null;
+
+            if (NativeBuffer == IntPtr.Zero)
+                throw new ObjectDisposedException("The match buffer has been disposed");
+
+            return new PcreMatchStatistics(
+                (long)_stats->step_count,
+                (long)_stats->backtrack_count,
+                (long)_stats->start_position_count,
+                (long)_stats->skipped_length,
+                (long)_stats->heap_frames_size
+            );
+        }
+    }
+
+    /// <summary>
+    /// Returns the profile of the pattern items reached by the matches of this buffer, since it was created or since the last call to <see cref="ResetProfile"/>.
+    /// </summary>
+    /// <remarks>
+    /// Profiles are only collected when the buffer is created with <see cref="PcreMatchSettings.CollectProfile"/>, this returns <c>null</c> otherwise.
+    /// </remarks>
+    [ForwardTo8Bit]
+    public PcrePatternProfile? GetProfile()
+    {
+        if (_profile == null)
+            return null;
+
+        var nativeEntries = GetProfileSpan();
+        var entryCount = 0;
+
+        foreach (ref readonly var nativeEntry in nativeEntries)
+        {
+            if (nativeEntry.hit_count != 0)
+                ++entryCount;
+        }
+
+        var entries = new PcrePatternProfileEntry[entryCount];
+        entryCount = 0;
+
+        for (var position = 0; position < nativeEntries.Length; ++position)
+        {
+            ref readonly var nativeEntry = ref nativeEntries[position];
+            if (nativeEntry.hit_count == 0)
+                continue;
+
+            entries[entryCount++] = new PcrePatternProfileEntry(
+                position,
+                (int)nativeEntry.next_item_length,
+                (long)nativeEntry.hit_count,
+                (long)nativeEntry.sample_count,
+                TimeSpan.FromTicks((long)(nativeEntry.sampled_time / 100))
+            );
+        }
+
+        return new PcrePatternProfile(entries);
+    }
+
+    /// <summary>
+    /// Clears the profile collected by this buffer.
+    /// </summary>
+    /// <remarks>
+    /// This does nothing when the buffer is not created with <see cref="PcreMatchSettings.CollectProfile"/>.
+    /// </remarks>
+    [ForwardTo8Bit]
+    public void ResetProfile()
+    {
+        if (_profile != null)
+            GetProfileSpan().Clear();
+    }
+
+    [ForwardTo8Bit]
+    private Span<Native.profile_entry> GetProfileSpan()
+    {
+        if (NativeBuffer == IntPtr.Zero)
+            throw new ObjectDisposedException("The match buffer has been disposed");
+
+        return new Span<Native.profile_entry>(_profile, _profileLength);
+    }
+
     /// <inheritdoc />
     [ForwardTo8Bit]
     ~PcreMatchBuffer()
@@ -17,17 +17,33 @@ public sealed unsafe partial class PcreMatchBuffer8Bit : IPcreMatchBuffer, IRege
     internal readonly InternalRegex8Bit Regex;
     private readonly int _outputVectorSize;
     private PcreJitStack? _jitStack; // GC reference
+    private readonly TimeSpan _timeout;
+    private readonly CancellationToken _cancellationToken;
+    private readonly bool _allowsLiteralMatch;
+    private readonly bool _allowsPrefilter;
 
     internal IntPtr NativeBuffer;
+    internal int PoolState; // One of the MatchBufferPool states
 
     internal readonly nuint* OutputVector;
     internal readonly nuint[] CalloutOutputVector;
+    private readonly Native.match_stats* _stats;
+    private readonly Native.profile_entry* _profile;
+    private readonly int _profileLength;
 
     InternalRegex IPcreMatchBuffer.Regex => Regex;
     IntPtr IPcreMatchBuffer.NativeBuffer => NativeBuffer;
     nuint[] IPcreMatchBuffer.CalloutOutputVector => CalloutOutputVector;
+    TimeSpan IPcreMatchBuffer.Timeout => _timeout;
+    CancellationToken IPcreMatchBuffer.CancellationToken => _cancellationToken;
+    bool IPcreMatchBuffer.CollectStatistics => _stats != null;
+    bool IPcreMatchBuffer.AllowsLiteralMatch => _allowsLiteralMatch;
+    bool IPcreMatchBuffer.AllowsPrefilter => _allowsPrefilter;
+    Span<nuint> IPcreMatchBuffer.OutputVector => GetOutputVectorSpan();
     InternalRegex8Bit IRegexHolder8Bit.Regex => Regex;
 
+    ref int IPcreMatchBuffer.PoolState => ref PoolState;
+
     /// <summary>
     /// An enumerable of matches.
     /// </summary>
@@ -0,0 +1,31 @@
+﻿namespace PCRE;
+
+/// <summary>
+/// The location of a match or of a capturing group in a subject, without its value.
+/// </summary>
+/// <seealso cref="PcreRegex.EnumerateMatchRanges(System.ReadOnlySpan{char})"/>
+public readonly struct PcreMatchRange
+{
+    internal PcreMatchRange(nuint index, nuint endIndex)
+    {
+        // PCRE2_UNSET becomes -1
+        Index = (int)index;
+        EndIndex = (int)endIndex;
+    }
+
+    /// <inheritdoc cref="PcreGroup.Index"/>
+    public int Index { get; }
+
+    /// <inheritdoc cref="PcreGroup.EndIndex"/>
+    public int EndIndex { get; }
+
+    /// <inheritdoc cref="PcreGroup.Length"/>
+    public int Length => EndIndex > Index ? EndIndex - Index : 0;
+
+    /// <inheritdoc cref="PcreGroup.Success"/>
+    public bool Success => Index >= 0;
+
+    /// <inheritdoc />
+    public override string ToString()
+        => Success ? $"{Index}..{EndIndex}" : "<unset>";
+}
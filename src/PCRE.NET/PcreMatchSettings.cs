@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Threading;
 using PCRE.Internal;
 
 namespace PCRE;
@@ -13,6 +14,7 @@ public sealed unsafe class PcreMatchSettings
     private uint? _matchLimit;
     private uint? _depthLimit;
     private uint? _heapLimit;
+    private TimeSpan _timeout = System.Threading.Timeout.InfiniteTimeSpan;
 
     /// <summary>
     /// Limit for the amount of backtracking that can take place.
@@ -145,6 +147,118 @@ public sealed unsafe class PcreMatchSettings
     /// </summary>
     public PcreJitStack? JitStack { get; set; }
 
+    /// <summary>
+    /// The maximum amount of time a match can take, or <see cref="System.Threading.Timeout.InfiniteTimeSpan"/> for no timeout.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// The timeout applies to each individual call to <c>pcre2_match()</c>, <c>pcre2_dfa_match()</c> or <c>pcre2_substitute()</c>:
+    /// when enumerating matches, each match gets the full timeout. A <see cref="PcreMatchTimeoutException"/> is thrown when it elapses.
+    /// </para>
+    /// <para>
+    /// The deadline is checked by native code while matching, for the interpreter, the JIT and the DFA matcher, without involving callouts:
+    /// every few thousand steps counted towards the <see cref="MatchLimit"/>, the matcher reads the clock and checks the <see cref="CancellationToken"/>.
+    /// The cost of a deadline is therefore small, and doesn't depend on the pattern. A single step can take long though, such as a repeated character
+    /// scanning a long subject, so the match may run a bit past its deadline.
+    /// </para>
+    /// </remarks>
+    public TimeSpan Timeout
+    {
+        get => _timeout;
+        set => _timeout = ValidateTimeout(value);
+    }
+
+    /// <summary>
+    /// A cancellation token which abandons the match when cancelled.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// The token is checked in the same way as the <see cref="Timeout"/>. An <see cref="OperationCanceledException"/> is thrown when the match is cancelled.
+    /// </para>
+    /// <para>
+    /// A token which can be cancelled has the same small overhead as a <see cref="Timeout"/>, even if it is never cancelled.
+    /// Tokens which cannot be cancelled, such as <see cref="System.Threading.CancellationToken.None"/>, have no overhead.
+    /// </para>
+    /// </remarks>
+    public CancellationToken CancellationToken { get; set; }
+
+    /// <summary>
+    /// Selects the callouts which are passed to the callout function, or <c>null</c> to pass all of them.
+    /// </summary>
+    /// <remarks>
+    /// The callouts which are not selected are skipped in native code, without calling into managed code. See <see cref="PcreCalloutFilter"/>.
+    /// </remarks>
+    public PcreCalloutFilter? CalloutFilter { get; set; }
+
+    /// <summary>
+    /// Whether the <see cref="PcreCallout"/> object passed to the callout function is reused between the callouts of a match.
+    /// </summary>
+    /// <remarks>
+    /// This avoids allocating an object for each callout, but the <see cref="PcreCallout"/> and the <see cref="PcreCallout.Match"/> it provides
+    /// must not be used after the callout function returns. This setting has no effect on callouts which use <see cref="PcreRefCallout"/>, which never allocate.
+    /// </remarks>
+    public bool ReuseCallouts { get; set; }
+
+    /// <summary>
+    /// Whether match buffers created with these settings collect statistics about the effort spent by each match.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// This setting is only used by match buffers (see <see cref="PcreRegex.CreateMatchBuffer(PcreMatchSettings)"/>),
+    /// which expose the statistics of their last match through <see cref="PcreMatchBuffer.Statistics"/>.
+    /// </para>
+    /// <para>
+    /// Statistics are reported by the interpreter through automatic callouts: the first match which collects statistics compiles a copy of the pattern with automatic callouts.
+    /// Matches which collect statistics are therefore much slower than regular ones, and never use the JIT, so the statistics describe the interpreter only,
+    /// even for patterns compiled with <see cref="PcreOptions.Compiled"/>.
+    /// </para>
+    /// </remarks>
+    public bool CollectStatistics { get; set; }
+
+    /// <summary>
+    /// Whether match buffers created with these settings build a profile of the pattern items reached by their matches.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// This setting is only used by match buffers, which accumulate the profile of all their matches until it is retrieved with <see cref="PcreMatchBuffer.GetProfile"/>.
+    /// </para>
+    /// <para>
+    /// The profile is built in native code from automatic callouts, using the same copy of the pattern as <see cref="CollectStatistics"/>, so no callout crosses into managed code.
+    /// Both the interpreter and the JIT are supported. Patterns which contain an explicit callout numbered 255 are not compiled with automatic callouts and produce an empty profile.
+    /// </para>
+    /// </remarks>
+    public bool CollectProfile { get; set; }
+
+    internal static TimeSpan ValidateTimeout(TimeSpan timeout)
+    {
+        if (timeout != System.Threading.Timeout.InfiniteTimeSpan && (timeout <= TimeSpan.Zero || timeout.TotalMilliseconds > int.MaxValue))
+            throw new ArgumentOutOfRangeException(nameof(timeout), "The timeout must be positive and less than 2^31 milliseconds, or infinite.");
+
+        return timeout;
+    }
+
+    internal static ulong GetNativeTimeout(TimeSpan timeout)
+        => timeout == System.Threading.Timeout.InfiniteTimeSpan ? 0 : (ulong)timeout.Ticks * 100;
+
+    /// <summary>
+    /// Indicates whether a match with these settings may bypass PCRE2: no resource or offset limit, no deadline, and no diagnostics.
+    /// </summary>
+    internal bool AllowsLiteralMatch
+        => _matchLimit is null
+           && _depthLimit is null
+           && AllowsPrefilter;
+
+    /// <summary>
+    /// Indicates whether subjects which cannot match may be rejected before calling into native code: no heap or offset limit, no deadline, and no diagnostics.
+    /// </summary>
+    internal bool AllowsPrefilter
+        => _heapLimit is null
+           && OffsetLimit is null
+           && _timeout == System.Threading.Timeout.InfiniteTimeSpan
+           && !CancellationToken.CanBeCanceled
+           && !CollectStatistics
+           && !CollectProfile;
+
     internal void FillMatchSettings(ref Native.match_settings settings, out PcreJitStack? jitStack)
     {
         settings.match_limit = _matchLimit.GetValueOrDefault();
@@ -152,6 +266,10 @@ public sealed unsafe class PcreMatchSettings
         settings.heap_limit = _heapLimit.GetValueOrDefault();
         settings.offset_limit = OffsetLimit.GetValueOrDefault();
         settings.jit_stack = JitStack is { } stack ? stack.GetStack() : null;
+        settings.timeout = GetNativeTimeout(_timeout);
+        settings.cancellation_flag = null;
+        settings.auto_callouts = 0;
+        settings.callout_filter = null;
 
         jitStack = JitStack;
     }
@@ -0,0 +1,64 @@
+﻿namespace PCRE;
+
+/// <summary>
+/// Statistics about the effort spent by the last match of a <see cref="PcreMatchBuffer"/>.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Statistics are only collected by match buffers created with <see cref="PcreMatchSettings.CollectStatistics"/>.
+/// </para>
+/// <para>
+/// The statistics describe the interpreter only: matches which collect them never use the JIT, even when the pattern is compiled with <see cref="PcreOptions.Compiled"/>.
+/// The JIT follows the same backtracking logic, so the step and backtrack counts still point at the costly parts of a pattern,
+/// but they don't tell how long a JIT match takes, nor which start positions the start-of-match optimizations of the JIT skip.
+/// </para>
+/// </remarks>
+/// <seealso cref="PcreMatchBuffer.Statistics"/>
+/// <seealso cref="PcreMatchBuffer8Bit.Statistics"/>
+public readonly struct PcreMatchStatistics
+{
+    internal PcreMatchStatistics(long stepCount, long backtrackCount, long startPositionCount, long skippedLength, long heapFramesSize)
+    {
+        StepCount = stepCount;
+        BacktrackCount = backtrackCount;
+        StartPositionCount = startPositionCount;
+        SkippedLength = skippedLength;
+        HeapFramesSize = heapFramesSize;
+    }
+
+    /// <summary>
+    /// The number of pattern items the interpreter attempted to match.
+    /// </summary>
+    /// <remarks>
+    /// This is the number of automatic callouts which were reached, which approximates the number of steps of the matching loop.
+    /// </remarks>
+    public long StepCount { get; }
+
+    /// <summary>
+    /// The number of times the interpreter backtracked.
+    /// </summary>
+    public long BacktrackCount { get; }
+
+    /// <summary>
+    /// The number of start positions in the subject at which a match was attempted.
+    /// </summary>
+    public long StartPositionCount { get; }
+
+    /// <summary>
+    /// The number of start positions in the subject which were skipped by the start-of-match optimizations, in code units.
+    /// </summary>
+    public long SkippedLength { get; }
+
+    /// <summary>
+    /// The size of the heap memory used by the interpreter to remember backtracking positions, in bytes.
+    /// </summary>
+    /// <remarks>
+    /// This memory is kept by the buffer between matches, so this is the largest size required by any match since the buffer was created.
+    /// The JIT uses its own stack instead (see <see cref="PcreJitStack"/>), which is not reported.
+    /// </remarks>
+    public long HeapFramesSize { get; }
+
+    /// <inheritdoc />
+    public override string ToString()
+        => $"Steps: {StepCount}, Backtracks: {BacktrackCount}, Start positions: {StartPositionCount}, Skipped: {SkippedLength}, Heap frames: {HeapFramesSize}";
+}
@@ -40,6 +40,17 @@ public sealed class PcrePatternInfo
     /// </summary>
     public int CaptureCount => _re.CaptureCount;
 
+    /// <summary>
+    /// Returns the number of live regex objects which share this compiled pattern.
+    /// </summary>
+    /// <remarks>
+    /// <see cref="PcreRegex"/> objects created with the same pattern and settings share a single compiled pattern and its JIT-compiled code,
+    /// for as long as any of them is alive. Regex objects which are no longer referenced are still counted until they are collected by the GC.
+    /// The temporary regex objects used by the static methods of <see cref="PcreRegex"/> are not counted.
+    /// This is always 1 for <see cref="PcreRegex8Bit"/> and <see cref="PcreRegexUtf8"/> objects, which don't share their compiled pattern.
+    /// </remarks>
+    public int InstanceCount => _re.InstanceCount;
+
     /// <summary>
     /// <c>PCRE2_INFO_ARGOPTIONS</c> - Returns the options used for pattern compilation.
     /// </summary>
@@ -0,0 +1,41 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace PCRE;
+
+/// <summary>
+/// A profile of the pattern items reached by the matches of a <see cref="PcreMatchBuffer"/>.
+/// </summary>
+/// <remarks>
+/// Profiles are only collected by match buffers created with <see cref="PcreMatchSettings.CollectProfile"/>.
+/// </remarks>
+/// <seealso cref="PcreMatchBuffer.GetProfile"/>
+/// <seealso cref="PcreMatchBuffer8Bit.GetProfile"/>
+public sealed class PcrePatternProfile
+{
+    internal PcrePatternProfile(PcrePatternProfileEntry[] entries)
+    {
+        Entries = entries;
+
+        foreach (var entry in entries)
+        {
+            TotalHitCount += entry.HitCount;
+            EstimatedTotalTime += entry.EstimatedTime;
+        }
+    }
+
+    /// <summary>
+    /// The pattern items which were reached at least once, in pattern order.
+    /// </summary>
+    public IReadOnlyList<PcrePatternProfileEntry> Entries { get; }
+
+    /// <summary>
+    /// The total number of times any pattern item was reached.
+    /// </summary>
+    public long TotalHitCount { get; }
+
+    /// <summary>
+    /// The estimated total time spent matching pattern items.
+    /// </summary>
+    public TimeSpan EstimatedTotalTime { get; }
+}
@@ -0,0 +1,57 @@
+﻿using System;
+
+namespace PCRE;
+
+/// <summary>
+/// The profile of a single pattern item.
+/// </summary>
+/// <seealso cref="PcrePatternProfile"/>
+public readonly struct PcrePatternProfileEntry
+{
+    internal PcrePatternProfileEntry(int patternPosition, int nextPatternItemLength, long hitCount, long sampleCount, TimeSpan sampledTime)
+    {
+        PatternPosition = patternPosition;
+        NextPatternItemLength = nextPatternItemLength;
+        HitCount = hitCount;
+        SampleCount = sampleCount;
+        SampledTime = sampledTime;
+    }
+
+    /// <summary>
+    /// The position of the item in the pattern.
+    /// </summary>
+    public int PatternPosition { get; }
+
+    /// <inheritdoc cref="PcreCalloutInfo.NextPatternItemLength"/>
+    public int NextPatternItemLength { get; }
+
+    /// <summary>
+    /// The number of times the matching engine reached this item.
+    /// </summary>
+    public long HitCount { get; }
+
+    /// <summary>
+    /// The number of times this item was timed.
+    /// </summary>
+    /// <remarks>
+    /// Only a fraction of the items reached are timed, as timing each of them would cost more than matching most items.
+    /// </remarks>
+    public long SampleCount { get; }
+
+    /// <summary>
+    /// The total time spent matching this item when it was timed, including any backtracking into it.
+    /// </summary>
+    public TimeSpan SampledTime { get; }
+
+    /// <summary>
+    /// The estimated total time spent matching this item, extrapolated from the sampled time.
+    /// </summary>
+    public TimeSpan EstimatedTime
+        => SampleCount != 0
+            ? TimeSpan.FromTicks((long)((double)SampledTime.Ticks * HitCount / SampleCount))
+            : TimeSpan.Zero;
+
+    /// <inheritdoc />
+    public override string ToString()
+        => $"Position: {PatternPosition}, Length: {NextPatternItemLength}, Hits: {HitCount}, Estimated time: {EstimatedTime}";
+}
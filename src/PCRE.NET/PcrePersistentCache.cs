@@ -0,0 +1,80 @@
+﻿using System;
+using System.Reflection;
+using PCRE.Internal;
+
+namespace PCRE;
+
+/// <summary>
+/// An on-disk cache of compiled patterns, which can be shared between processes.
+/// </summary>
+/// <remarks>
+/// <para>
+/// When enabled, compiled patterns are serialized to the cache directory, and later compilations of the same pattern with the same settings
+/// load them back instead of compiling the pattern again, even in a different process.
+/// </para>
+/// <para>
+/// Entries are keyed by the pattern, its compile settings, the character width, the PCRE2 version and the process architecture.
+/// Entries which don't match or which are corrupted are ignored: the pattern is compiled normally, and the entry is written again.
+/// </para>
+/// <para>
+/// The cache stores the PCRE2 bytecode, not the JIT output: the machine code generated by the JIT compiler embeds the addresses
+/// of the pattern bytecode, of the tables and helper functions of the native library, and of its own labels, which change with each process.
+/// The same goes for the state of the sljit compiler before code generation. Patterns loaded from the cache are therefore still JIT-compiled if requested.
+/// </para>
+/// <para>
+/// Cache entries can also be embedded in an assembly, so that patterns are not compiled to bytecode at startup:
+/// set the <c>PcreNetPrecompiledPatterns</c> MSBuild property to a cache directory which has been populated beforehand,
+/// for instance by running the test suite on the target platform. Its entries are then embedded as resources,
+/// and they are registered automatically by the code generated for calls with constant patterns,
+/// or explicitly with <see cref="AddPrecompiledPatterns"/>.
+/// </para>
+/// <para>
+/// The contents of the cache directory are trusted: only use a directory which cannot be written by untrusted users.
+/// </para>
+/// </remarks>
+public static class PcrePersistentCache
+{
+    /// <summary>
+    /// The directory which holds the cache, or <c>null</c> to disable the cache.
+    /// </summary>
+    /// <remarks>
+    /// The cache is disabled by default. The directory is created when the first entry is written.
+    /// </remarks>
+    public static string? Directory
+    {
+        get => PersistentCache.Directory;
+        set => PersistentCache.Directory = value;
+    }
+
+    /// <summary>
+    /// The number of patterns which have been loaded from the cache by the current process.
+    /// </summary>
+    public static long HitCount => PersistentCache.HitCount;
+
+    /// <summary>
+    /// The number of patterns which had to be compiled by the current process while the cache was enabled.
+    /// </summary>
+    public static long MissCount => PersistentCache.MissCount;
+
+    /// <summary>
+    /// Registers the cache entries embedded in the given assembly.
+    /// </summary>
+    /// <remarks>
+    /// Embedded entries are looked up before the cache directory, and are used even if <see cref="Directory"/> is <c>null</c>.
+    /// Entries which don't match the current PCRE2 version or process architecture are ignored.
+    /// </remarks>
+    /// <param name="assembly">The assembly which contains the embedded entries.</param>
+    public static void AddPrecompiledPatterns(Assembly assembly)
+    {
+        if (assembly == null)
+            throw new ArgumentNullException(nameof(assembly));
+
+        PersistentCache.AddPrecompiledEntries(assembly);
+    }
+
+    /// <summary>
+    /// Deletes the entries of the cache directory.
+    /// </summary>
+    public static void Clear()
+        => PersistentCache.Clear();
+}
@@ -46,14 +46,9 @@ public partial class PcreRegex
         if (unchecked((uint)startIndex > (uint)subject.Length))
             ThrowInvalidStartIndex();
 
-        var outputVector = InternalRegex.CanStackAllocOutputVector
-            ? stackalloc nuint[InternalRegex.OutputVectorSize]
-            : new nuint[InternalRegex.OutputVectorSize];
-
-        var match = new PcreRefMatch(InternalRegex, outputVector);
-        match.FirstMatch(subject, PcreMatchSettings.Default, startIndex, 0, null, null);
-
-        return match.Success;
+        // Only the range of the match is needed, which avoids sizing the output vector for all the groups.
+        Span<nuint> outputVector = stackalloc nuint[2];
+        return InternalRegex.MatchRanges(outputVector, subject, ReadOnlySpan<int>.Empty, PcreMatchSettings.Default, startIndex, 0) > 0;
     }
 
     /// <include file='PcreRegex.xml' path='/doc/method[@name="Match"]/*'/>
@@ -316,6 +311,64 @@ public partial class PcreRegex
         return new RefMatchEnumerable(InternalRegex, subject, startIndex, options, onCallout, settings);
     }
 
+    /// <include file='PcreRegex.xml' path='/doc/method[@name="EnumerateMatchRanges"]/*'/>
+    /// <include file='PcreRegex.xml' path='/doc/param[@name="subject"]'/>
+    /// <remarks>
+    /// <include file='PcreRegex.xml' path='/doc/remarks[@name="matchRanges"]/*'/>
+    /// </remarks>
+    [Pure]
+    [ForwardTo8Bit]
+    public MatchRangeEnumerable EnumerateMatchRanges(ReadOnlySpan<char> subject)
+        => EnumerateMatchRanges(subject, 0, PcreMatchOptions.None, ReadOnlySpan<int>.Empty, Span<PcreMatchRange>.Empty);
+
+    /// <include file='PcreRegex.xml' path='/doc/method[@name="EnumerateMatchRanges"]/*'/>
+    /// <include file='PcreRegex.xml' path='/doc/param[@name="subject" or @name="startIndex"]'/>
+    /// <remarks>
+    /// <include file='PcreRegex.xml' path='/doc/remarks[@name="matchRanges" or @name="startIndex"]/*'/>
+    /// </remarks>
+    [Pure]
+    [ForwardTo8Bit]
+    public MatchRangeEnumerable EnumerateMatchRanges(ReadOnlySpan<char> subject, int startIndex)
+        => EnumerateMatchRanges(subject, startIndex, PcreMatchOptions.None, ReadOnlySpan<int>.Empty, Span<PcreMatchRange>.Empty);
+
+    /// <include file='PcreRegex.xml' path='/doc/method[@name="EnumerateMatchRanges"]/*'/>
+    /// <include file='PcreRegex.xml' path='/doc/param[@name="subject" or @name="startIndex" or @name="options"]'/>
+    /// <remarks>
+    /// <include file='PcreRegex.xml' path='/doc/remarks[@name="matchRanges" or @name="startIndex"]/*'/>
+    /// </remarks>
+    [Pure]
+    [ForwardTo8Bit]
+    public MatchRangeEnumerable EnumerateMatchRanges(ReadOnlySpan<char> subject, int startIndex, PcreMatchOptions options)
+        => EnumerateMatchRanges(subject, startIndex, options, ReadOnlySpan<int>.Empty, Span<PcreMatchRange>.Empty);
+
+    /// <include file='PcreRegex.xml' path='/doc/method[@name="EnumerateMatchRanges"]/*'/>
+    /// <include file='PcreRegex.xml' path='/doc/param[@name="subject" or @name="startIndex" or @name="options" or @name="groups" or @name="groupRanges"]'/>
+    /// <remarks>
+    /// <include file='PcreRegex.xml' path='/doc/remarks[@name="matchRanges" or @name="startIndex"]/*'/>
+    /// <para>
+    /// The <paramref name="groupRanges"/> buffer is overwritten on each iteration.
+    /// Locating more than 32 groups allocates an output vector for the enumeration.
+    /// </para>
+    /// </remarks>
+    [Pure]
+    [ForwardTo8Bit]
+    public MatchRangeEnumerable EnumerateMatchRanges(ReadOnlySpan<char> subject, int startIndex, PcreMatchOptions options, ReadOnlySpan<int> groups, Span<PcreMatchRange> groupRanges)
+    {
+        if (unchecked((uint)startIndex > (uint)subject.Length))
+            ThrowInvalidStartIndex();
+
+        if (groupRanges.Length != groups.Length)
+            throw new ArgumentException("The group ranges buffer must have the same length as the list of groups.", nameof(groupRanges));
+
+        foreach (var group in groups)
+        {
+            if (unchecked((uint)group > (uint)InternalRegex.CaptureCount))
+                throw new ArgumentOutOfRangeException(nameof(groups), group, "Invalid group index.");
+        }
+
+        return new MatchRangeEnumerable(InternalRegex, subject, startIndex, options, groups, groupRanges);
+    }
+
     private IEnumerable<PcreMatch> MatchesIterator(string subject, int startIndex, PcreMatchOptions options, Func<PcreCallout, PcreCalloutResult>? onCallout, PcreMatchSettings settings)
     {
         var match = InternalRegex.Match(subject, settings, startIndex, options.ToPatternOptions(), onCallout);
@@ -363,7 +416,7 @@ public partial class PcreRegex
     /// </remarks>
     [Pure]
     public static bool IsMatch(string subject, string pattern, PcreOptions options, int startIndex)
-        => new PcreRegex(pattern, options).IsMatch(subject, startIndex);
+        => GetTemporary(pattern, options).IsMatch(subject, startIndex);
 
     /// <include file='PcreRegex.xml' path='/doc/method[@name="Match"]/*'/>
     /// <include file='PcreRegex.xml' path='/doc/param[@name="subject" or @name="pattern"]'/>
@@ -390,7 +443,7 @@ public partial class PcreRegex
     /// </remarks>
     [Pure]
     public static PcreMatch Match(string subject, string pattern, PcreOptions options, int startIndex)
-        => new PcreRegex(pattern, options).Match(subject, startIndex);
+        => GetTemporary(pattern, options).Match(subject, startIndex);
 
     /// <include file='PcreRegex.xml' path='/doc/method[@name="Matches"]/*'/>
     /// <include file='PcreRegex.xml' path='/doc/param[@name="subject" or @name="pattern"]'/>
@@ -417,7 +470,7 @@ public partial class PcreRegex
     /// </remarks>
     [Pure]
     public static IEnumerable<PcreMatch> Matches(string subject, string pattern, PcreOptions options, int startIndex)
-        => new PcreRegex(pattern, options).Matches(subject, startIndex);
+        => GetTemporary(pattern, options).Matches(subject, startIndex);
 
     [ForwardTo8Bit]
     private static void ThrowInvalidStartIndex()
@@ -539,4 +592,133 @@ public partial class PcreRegex
             return false;
         }
     }
+
+    /// <summary>
+    /// An enumerable of match locations against a <see cref="ReadOnlySpan{T}"/>.
+    /// </summary>
+    [ForwardTo8Bit]
+    public readonly ref struct MatchRangeEnumerable
+    {
+        private readonly ReadOnlySpan<char> _subject;
+        private readonly int _startIndex;
+        private readonly PcreMatchOptions _options;
+        private readonly ReadOnlySpan<int> _groups;
+        private readonly Span<PcreMatchRange> _groupRanges;
+        private readonly InternalRegex16Bit _regex;
+
+        [ForwardTo8Bit]
+        internal MatchRangeEnumerable(InternalRegex16Bit regex,
+                                      ReadOnlySpan<char> subject,
+                                      int startIndex,
+                                      PcreMatchOptions options,
+                                      ReadOnlySpan<int> groups,
+                                      Span<PcreMatchRange> groupRanges)
+        {
+            _regex = regex;
+            _subject = subject;
+            _startIndex = startIndex;
+            _options = options;
+            _groups = groups;
+            _groupRanges = groupRanges;
+        }
+
+        /// <inheritdoc cref="IEnumerable{T}.GetEnumerator"/>
+        [ForwardTo8Bit]
+        public MatchRangeEnumerator GetEnumerator()
+            => new(_regex, _subject, _startIndex, _options, _groups, _groupRanges);
+
+        /// <summary>
+        /// Counts the matches.
+        /// </summary>
+        [ForwardTo8Bit]
+        public int Count()
+        {
+            var count = 0;
+
+            foreach (var _ in this)
+                ++count;
+
+            return count;
+        }
+    }
+
+    /// <summary>
+    /// An enumerator of match locations against a <see cref="ReadOnlySpan{T}"/>.
+    /// </summary>
+    [ForwardTo8Bit]
+    public ref struct MatchRangeEnumerator
+    {
+        private readonly ReadOnlySpan<char> _subject;
+        private readonly PcreMatchOptions _options;
+        private readonly ReadOnlySpan<int> _groups;
+        private readonly Span<PcreMatchRange> _groupRanges;
+        private readonly nuint[]? _outputVector;
+        private InternalRegex16Bit? _regex;
+        private PcreMatchRange _match;
+        private int _nextIndex;
+        private bool _started;
+
+        [ForwardTo8Bit]
+        internal MatchRangeEnumerator(InternalRegex16Bit regex,
+                                      ReadOnlySpan<char> subject,
+                                      int startIndex,
+                                      PcreMatchOptions options,
+                                      ReadOnlySpan<int> groups,
+                                      Span<PcreMatchRange> groupRanges)
+        {
+            _regex = regex;
+            _subject = subject;
+            _nextIndex = startIndex;
+            _options = options;
+            _groups = groups;
+            _groupRanges = groupRanges;
+            _outputVector = groups.Length > Internal.InternalRegex.MaxStackAllocCaptureCount ? new nuint[2 * (groups.Length + 1)] : null;
+            _match = default;
+            _started = false;
+        }
+
+        /// <summary>
+        /// Gets the location of the current match.
+        /// </summary>
+        [ForwardTo8Bit]
+        public readonly PcreMatchRange Current => _match;
+
+        /// <summary>
+        /// Moves to the next match.
+        /// </summary>
+        [ForwardTo8Bit]
+        public bool MoveNext()
+        {
+            if (_regex == null)
+                return false;
+
+            var options = _options.ToPatternOptions();
+
+            if (_started)
+                options |= PcreConstants.PCRE2_NO_UTF_CHECK | (_match.Length == 0 ? PcreConstants.PCRE2_NOTEMPTY_ATSTART : 0);
+
+            var outputVector = _outputVector is null
+                ? stackalloc nuint[2 * (_groups.Length + 1)]
+                : _outputVector.AsSpan();
+            var resultCode = _regex.MatchRanges(outputVector, _subject, _groups, PcreMatchSettings.Default, _nextIndex, options);
+
+            _started = true;
+
+            if (resultCode <= 0)
+            {
+                _regex = null;
+                _match = default;
+                return false;
+            }
+
+            _match = new PcreMatchRange(outputVector[0], outputVector[1]);
+
+            for (var i = 0; i < _groupRanges.Length; ++i)
+                _groupRanges[i] = new PcreMatchRange(outputVector[2 * i + 2], outputVector[2 * i + 3]);
+
+            // It's possible to have EndIndex < Index when the pattern contains \K in a lookahead
+            _nextIndex = Math.Max(_match.Index, _match.EndIndex);
+            return true;
+        }
+    }
 }
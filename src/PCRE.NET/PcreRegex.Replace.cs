@@ -133,7 +133,7 @@ public partial class PcreRegex
     /// <seealso cref="Substitute(string,string)"/>
     [Pure]
     public static string Replace(string subject, string pattern, string replacement, PcreOptions options, int count, int startIndex)
-        => new PcreRegex(pattern, options).Replace(subject, replacement, count, startIndex);
+        => GetTemporary(pattern, options).Replace(subject, replacement, count, startIndex);
 
     /// <include file='PcreRegex.xml' path='/doc/method[@name="Replace"]/*'/>
     /// <include file='PcreRegex.xml' path='/doc/param[@name="subject" or @name="pattern" or @name="replacementFunc"]'/>
@@ -169,5 +169,5 @@ public partial class PcreRegex
     /// </remarks>
     /// <seealso cref="Substitute(string,string)"/>
     public static string Replace(string subject, string pattern, Func<PcreMatch, string> replacementFunc, PcreOptions options, int count, int startIndex)
-        => new PcreRegex(pattern, options).Replace(subject, replacementFunc, count, startIndex);
+        => GetTemporary(pattern, options).Replace(subject, replacementFunc, count, startIndex);
 }
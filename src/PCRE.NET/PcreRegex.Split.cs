@@ -145,5 +145,5 @@ public partial class PcreRegex
     /// </remarks>
     [Pure]
     public static IEnumerable<string> Split(string subject, string pattern, PcreOptions options, PcreSplitOptions splitOptions, int count, int startIndex)
-        => new PcreRegex(pattern, options).Split(subject, splitOptions, count, startIndex);
+        => GetTemporary(pattern, options).Split(subject, splitOptions, count, startIndex);
 }
@@ -216,5 +216,5 @@ public partial class PcreRegex
     /// <seealso cref="Replace(string,string)"/>
     [Pure]
     public static string Substitute(string subject, string pattern, string replacement, PcreOptions options, PcreSubstituteOptions substituteOptions)
-        => new PcreRegex(pattern, options).Substitute(subject, replacement, substituteOptions);
+        => GetTemporary(pattern, options).Substitute(subject, replacement, substituteOptions);
 }
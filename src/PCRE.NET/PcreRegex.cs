@@ -34,7 +34,8 @@ public partial class PcreRegex
     /// <remarks>
     /// The cache is used for the following items:
     /// <list type="bullet">
-    /// <item>Regex patterns: each instantiation of <see cref="PcreRegex"/> or usage of the static matching methods tries to find the pattern in the cache before compiling it.</item>
+    /// <item>Regex patterns: each instantiation of <see cref="PcreRegex"/> or usage of the static matching methods tries to find the pattern in the cache before compiling it.
+    /// Patterns which are not in the cache are still shared between instances as long as one of them is alive.</item>
     /// <item>Replacement strings: recently used replacement strings are not parsed if available in the cache.</item>
     /// </list>
     /// Set this to 0 to disable the cache.
@@ -81,6 +82,21 @@ public partial class PcreRegex
             throw new ArgumentNullException(nameof(settings));
 
         InternalRegex = Caches.RegexCache.GetOrAdd(new RegexKey(pattern, settings.ToReadOnlySnapshot(_additionalOptions)));
+        InternalRegex.AddInstance(this);
+    }
+
+    /// <summary>
+    /// Creates a regex for a single call of a static helper, which is not counted as an instance of its compiled pattern.
+    /// </summary>
+    private PcreRegex(InternalRegex16Bit internalRegex)
+        => InternalRegex = internalRegex;
+
+    private static PcreRegex GetTemporary(string pattern, PcreOptions options)
+    {
+        if (pattern == null)
+            throw new ArgumentNullException(nameof(pattern));
+
+        return new PcreRegex(Caches.RegexCache.GetOrAdd(new RegexKey(pattern, OptionsToSettings(options).ToReadOnlySnapshot(_additionalOptions))));
     }
 
     /// <summary>
@@ -108,6 +124,63 @@ public partial class PcreRegex
     public PcreMatchBuffer CreateMatchBuffer(PcreMatchSettings settings)
         => new(InternalRegex, settings ?? throw new ArgumentNullException(nameof(settings)));
 
+    /// <summary>
+    /// Rents a buffer for zero-allocation matching from a pool shared by all the instances of this pattern.
+    /// </summary>
+    /// <remarks>
+    /// The pool keeps at most one buffer per processor, so concurrent callers can reuse native match data without allocating.
+    /// The rented buffer uses the default match settings. It is not thread-safe and should be given back with <see cref="ReturnMatchBuffer"/>
+    /// once it is no longer used. A buffer which is never returned is simply reclaimed by the garbage collector.
+    /// </remarks>
+    [ForwardTo8Bit]
+    public PcreMatchBuffer RentMatchBuffer()
+        => InternalRegex.MatchBufferPool.Rent();
+
+    /// <summary>
+    /// Returns a buffer rented with <see cref="RentMatchBuffer"/> to the pool.
+    /// </summary>
+    /// <remarks>
+    /// The buffer must not be used after it has been returned, and returning it twice throws an <see cref="InvalidOperationException"/>.
+    /// It is disposed if the pool is full.
+    /// </remarks>
+    /// <param name="buffer">The buffer to return.</param>
+    [ForwardTo8Bit]
+    public void ReturnMatchBuffer(PcreMatchBuffer buffer)
+    {
+        if (buffer is null)
+            throw new ArgumentNullException(nameof(buffer));
+
+        if (buffer.PoolState == MatchBufferPool.NotPooled || !ReferenceEquals(buffer.Regex, InternalRegex))
+            throw new ArgumentException("The buffer was not rented from this pattern.", nameof(buffer));
+
+        InternalRegex.MatchBufferPool.Return(buffer);
+    }
+
+    /// <summary>
+    /// Checks whether the subject is a valid UTF-16 string.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// When <see cref="PcreOptions.Utf"/> is set, the subject is validated on each match call.
+    /// A subject which has been validated once can be matched against any number of patterns with <see cref="PcreMatchOptions.NoUtfCheck"/>, which skips this check.
+    /// </para>
+    /// <para>
+    /// This method doesn't remember the subject: the matches still validate it, unless <see cref="PcreMatchOptions.NoUtfCheck"/> is passed explicitly.
+    /// Only pass it for subjects which haven't been modified since they were validated: matching an invalid subject with <see cref="PcreMatchOptions.NoUtfCheck"/>
+    /// is undefined behavior, unless the pattern is compiled with <see cref="PcreOptions.MatchInvalidUtf"/>.
+    /// Enumerating the matches of a subject already validates it only once.
+    /// </para>
+    /// </remarks>
+    /// <param name="subject">The subject string.</param>
+    public static bool IsValidUtf(ReadOnlySpan<char> subject)
+        => InternalRegex16Bit.IsValidUtf(subject, out _);
+
+    /// <inheritdoc cref="IsValidUtf(ReadOnlySpan{char})"/>
+    /// <param name="subject">The subject string.</param>
+    /// <param name="errorOffset">The offset of the first invalid code unit, or -1 if the subject is valid.</param>
+    public static bool IsValidUtf(ReadOnlySpan<char> subject, out int errorOffset)
+        => InternalRegex16Bit.IsValidUtf(subject, out errorOffset);
+
     /// <summary>
     /// Returns the regex pattern.
     /// </summary>
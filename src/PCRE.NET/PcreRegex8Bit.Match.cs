@@ -35,4 +35,33 @@ public partial class PcreRegex8Bit
         private InternalRegex8Bit? _regex;
         private PcreRefMatch8Bit _match;
     }
+
+    /// <summary>
+    /// An enumerable of match locations against a <see cref="ReadOnlySpan{T}"/>.
+    /// </summary>
+    public readonly ref partial struct MatchRangeEnumerable
+    {
+        private readonly ReadOnlySpan<byte> _subject;
+        private readonly int _startIndex;
+        private readonly PcreMatchOptions _options;
+        private readonly ReadOnlySpan<int> _groups;
+        private readonly Span<PcreMatchRange> _groupRanges;
+        private readonly InternalRegex8Bit _regex;
+    }
+
+    /// <summary>
+    /// An enumerator of match locations against a <see cref="ReadOnlySpan{T}"/>.
+    /// </summary>
+    public ref partial struct MatchRangeEnumerator
+    {
+        private readonly ReadOnlySpan<byte> _subject;
+        private readonly PcreMatchOptions _options;
+        private readonly ReadOnlySpan<int> _groups;
+        private readonly Span<PcreMatchRange> _groupRanges;
+        private readonly nuint[]? _outputVector;
+        private InternalRegex8Bit? _regex;
+        private PcreMatchRange _match;
+        private int _nextIndex;
+        private bool _started;
+    }
 }
@@ -76,6 +76,31 @@ public sealed class PcreRegexUtf8 : PcreRegex8Bit
         : base(CreateRegex(pattern, patternString, settings))
     { }
 
+    /// <summary>
+    /// Checks whether the subject is a valid UTF-8 string.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// When <see cref="PcreOptions.Utf"/> is set, the subject is validated on each match call.
+    /// A subject which has been validated once can be matched against any number of patterns with <see cref="PcreMatchOptions.NoUtfCheck"/>, which skips this check.
+    /// </para>
+    /// <para>
+    /// This method doesn't remember the subject: the matches still validate it, unless <see cref="PcreMatchOptions.NoUtfCheck"/> is passed explicitly.
+    /// Only pass it for subjects which haven't been modified since they were validated: matching an invalid subject with <see cref="PcreMatchOptions.NoUtfCheck"/>
+    /// is undefined behavior, unless the pattern is compiled with <see cref="PcreOptions.MatchInvalidUtf"/>.
+    /// Enumerating the matches of a subject already validates it only once.
+    /// </para>
+    /// </remarks>
+    /// <param name="subject">The subject string.</param>
+    public static bool IsValidUtf(ReadOnlySpan<byte> subject)
+        => InternalRegex8Bit.IsValidUtf(subject, out _);
+
+    /// <inheritdoc cref="IsValidUtf(ReadOnlySpan{byte})"/>
+    /// <param name="subject">The subject string.</param>
+    /// <param name="errorOffset">The offset of the first invalid code unit, or -1 if the subject is valid.</param>
+    public static bool IsValidUtf(ReadOnlySpan<byte> subject, out int errorOffset)
+        => InternalRegex8Bit.IsValidUtf(subject, out errorOffset);
+
     private static InternalRegex8Bit CreateRegex(ReadOnlySpan<byte> pattern, string patternString, PcreRegexSettings settings)
     {
         if (settings == null)
@@ -524,6 +524,9 @@ for the current character, one for the following character). */
     } \
   else return PCRE2_ERROR_DFA_WSSIZE
 
+/* PCRE.NET: match deadline check, defined in pcrenet_deadline.c */
+extern int pcrenet_match_limit_reached(const void *callout_data, const void *start);
+
 /* And now, here is the code */
 
 static int
@@ -563,7 +566,16 @@ BOOL utf = FALSE;
 
 BOOL reset_could_continue = FALSE;
 
-if (mb->match_call_count++ >= mb->match_limit) return PCRE2_ERROR_MATCHLIMIT;
+/* PCRE.NET: check the match deadline when the match limit is reached, which
+either fails the match or grants more steps. The limit applies to the whole
+call, so no start is given. */
+
+if (mb->match_call_count++ >= mb->match_limit)
+  {
+  int steps = pcrenet_match_limit_reached(mb->callout_data, NULL);
+  if (steps < 0) return steps;
+  mb->match_call_count = mb->match_limit - (uint32_t)steps + 1;
+  }
 if (rlevel++ > mb->match_limit_depth) return PCRE2_ERROR_DEPTHLIMIT;
 offsetcount &= (uint32_t)(-2);  /* Round down */
 
@@ -416,6 +416,8 @@ typedef struct compiler_common {
   sljit_s32 ovector_start;
   /* Points to the starting character of the current match. */
   sljit_s32 start_ptr;
+  /* PCRE.NET: return address and registers saved by the match limit check. */
+  sljit_s32 pcrenet_limit_save_ptr;
   /* Last known position of the requested byte. */
   sljit_s32 req_char_ptr;
   /* Head of the last recursion. */
@@ -3509,12 +3511,20 @@ while (list_item)
 common->stubs = NULL;
 }
 
+/* PCRE.NET: match deadline check, defined in pcrenet_jit_compile_inc.h */
+static void pcrenet_emit_match_limit_check(compiler_common *common);
+
 static SLJIT_INLINE void count_match(compiler_common *common)
 {
 DEFINE_COMPILER;
+struct sljit_jump *jump;
 
+/* PCRE.NET: the match limit check returns when the match deadline grants
+more steps, and leaves the match otherwise. */
 OP2(SLJIT_SUB | SLJIT_SET_Z, COUNT_MATCH, 0, COUNT_MATCH, 0, SLJIT_IMM, 1);
-add_jump(compiler, &common->calllimit, JUMP(SLJIT_ZERO));
+jump = JUMP(SLJIT_NOT_ZERO);
+add_jump(compiler, &common->calllimit, JUMP(SLJIT_FAST_CALL));
+JUMPHERE(jump);
 }
 
 static SLJIT_INLINE void allocate_stack(compiler_common *common, sljit_s32 size)
@@ -6941,11 +6951,15 @@ if (common->match_end_ptr != 0)
 
 static BOOL optimize_class(compiler_common *common, const sljit_u8 *bits, BOOL nclass, BOOL invert, jump_list **backtracks);
 
+/* PCRE.NET: vectorized search of the start bitmap, defined in pcrenet_jit_class_span_inc.h */
+static struct sljit_label *pcrenet_emit_start_bits_scan(compiler_common *common);
+
 static SLJIT_INLINE void fast_forward_start_bits(compiler_common *common)
 {
 DEFINE_COMPILER;
 const sljit_u8 *start_bits = common->re->start_bitmap;
 struct sljit_label *start;
+struct sljit_label *skip;
 struct sljit_jump *partial_quit;
 #if PCRE2_CODE_UNIT_WIDTH != 8
 struct sljit_jump *found = NULL;
@@ -6961,7 +6975,14 @@ if (common->match_end_ptr != 0)
   SELECT(SLJIT_GREATER, STR_END, TMP1, 0, STR_END);
   }
 
+/* PCRE.NET: skip the code units which are not in the start bitmap with a
+vectorized scan, which the loop continues with after a code unit which is not
+in the start bitmap. */
+skip = pcrenet_emit_start_bits_scan(common);
+
 start = LABEL();
+if (skip != NULL)
+  start = skip;
 
 partial_quit = CMP(SLJIT_GREATER_EQUAL, STR_PTR, 0, STR_END, 0);
 if (common->mode == PCRE2_JIT_COMPLETE)
@@ -10708,6 +10729,9 @@ if (common->utf && HAS_EXTRALEN(*cc)) *end += GET_EXTRALEN(*cc);
 return cc;
 }
 
+/* PCRE.NET: vectorized scan of character class runs, defined in pcrenet_jit_class_span_inc.h */
+static BOOL pcrenet_emit_class_span(compiler_common *common, PCRE2_UCHAR type, PCRE2_SPTR cc, jump_list **backtracks);
+
 static PCRE2_SPTR compile_iterator_matchingpath(compiler_common *common, PCRE2_SPTR cc, backtrack_common *parent, jump_list **prev_backtracks)
 {
 DEFINE_COMPILER;
@@ -11108,6 +11132,15 @@ switch(opcode)
     {
     OP1(SLJIT_MOV, base, offset1, STR_PTR, 0);
 
+    /* PCRE.NET: skip the start of long runs with a vectorized scan. */
+    if (opcode == OP_STAR && pcrenet_emit_class_span(common, type, cc, NULL))
+      {
+#if defined SUPPORT_UNICODE && PCRE2_CODE_UNIT_WIDTH != 32
+      if (common->utf)
+        OP1(SLJIT_MOV, TMP3, 0, STR_PTR, 0);
+#endif
+      }
+
     detect_partial_match(common, &no_match);
     label = LABEL();
     compile_char1_matchingpath(common, type, cc, &no_char1_match, FALSE);
@@ -11285,6 +11318,11 @@ switch(opcode)
     break;
     }
 
+  /* PCRE.NET: skip the start of long runs with a vectorized scan,
+  after the first character of a plus. */
+  if (pcrenet_emit_class_span(common, type, cc, exact == 1 ? prev_backtracks : NULL))
+    exact = 0;
+
 #if defined SUPPORT_UNICODE && PCRE2_CODE_UNIT_WIDTH != 32
   if (common->utf)
     {
@@ -13612,6 +13650,10 @@ if (common->has_set_som)
   common->ovector_start += sizeof(sljit_sw);
   }
 
+/* PCRE.NET: the return address and the five scratch registers. */
+common->pcrenet_limit_save_ptr = common->ovector_start;
+common->ovector_start += 6 * sizeof(sljit_sw);
+
 /* Aligning ovector to even number of sljit words. */
 if ((common->ovector_start & sizeof(sljit_sw)) != 0)
   common->ovector_start += sizeof(sljit_sw);
@@ -13995,8 +14037,8 @@ JUMPTO(SLJIT_JUMP, common->quit_label);
 
 /* Call limit reached. */
 set_jumps(common->calllimit, LABEL());
-OP1(SLJIT_MOV, SLJIT_RETURN_REG, 0, SLJIT_IMM, PCRE2_ERROR_MATCHLIMIT);
-JUMPTO(SLJIT_JUMP, common->quit_label);
+/* PCRE.NET: check the match deadline. */
+pcrenet_emit_match_limit_check(common);
 
 if (common->revertframes != NULL)
   {
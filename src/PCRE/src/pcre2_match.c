@@ -683,6 +683,9 @@ Returns:        MATCH_MATCH if matched            )  these values are >= 0
                 (e.g. stopped by repeated call or depth limit)
 */
 
+/* PCRE.NET: match deadline check, defined in pcrenet_deadline.c */
+extern int pcrenet_match_limit_reached(const void *callout_data, const void *start);
+
 static int
 match(PCRE2_SPTR start_eptr, PCRE2_SPTR start_ecode, uint16_t top_bracket,
   PCRE2_SIZE frame_size, pcre2_match_data *match_data, match_block *mb)
@@ -872,7 +875,15 @@ many backtracks (search tree is too large), or that we haven't exceeded the
 recursive depth limit (used too many backtracking frames). If not, process the
 opcodes. */
 
-if (mb->match_call_count++ >= mb->match_limit) return PCRE2_ERROR_MATCHLIMIT;
+/* PCRE.NET: check the match deadline when the match limit is reached, which
+either fails the match or grants more steps. */
+
+if (mb->match_call_count++ >= mb->match_limit)
+  {
+  int steps = pcrenet_match_limit_reached(mb->callout_data, start_eptr);
+  if (steps < 0) return steps;
+  mb->match_call_count = mb->match_limit - (uint32_t)steps + 1;
+  }
 if (Frdepth >= mb->match_limit_depth) return PCRE2_ERROR_DEPTHLIMIT;
 
 #ifdef DEBUG_SHOW_OPS
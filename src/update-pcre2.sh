@@ -20,4 +20,9 @@ cp pcre2_chartables.c.dist pcre2_chartables.c
   cat config.h.generic
 } > config.h
 
+# Local changes to the PCRE2 sources, see the comments marked with PCRE.NET in the patched files
+for patch in ../../PCRE.NET.Native/patches/*.patch; do
+  patch -p1 -d .. < "$patch"
+done
+
 echo 'PCRE2 release patched successfully.'